@@ -13,6 +13,93 @@ extern "C" {
  */
 typedef struct nkit_arena_s nkit_arena_t;
 
+/**
+ * @brief Page size backing an arena (requested, or actually obtained).
+ *
+ * Values are ordered by TLB reach, so backings compare with < and >.
+ */
+typedef enum {
+    NKIT_PAGE_DEFAULT = 0, ///< Request only: default hugetlbfs size, else 4KB
+    NKIT_PAGE_4K      = 1, ///< Standard pages
+    NKIT_PAGE_THP     = 2, ///< Standard pages with madvise(MADV_HUGEPAGE), 2MB aligned
+    NKIT_PAGE_2M      = 3, ///< hugetlbfs 2MB pages (MAP_HUGE_2MB)
+    NKIT_PAGE_1G      = 4  ///< hugetlbfs 1GB pages (MAP_HUGE_1GB)
+} nkit_page_size_t;
+
+/**
+ * @brief When the pages of an arena are faulted in.
+ */
+typedef enum {
+    NKIT_PREFAULT_NONE     = 0, ///< Lazily, on first touch (default)
+    NKIT_PREFAULT_POPULATE = 1, ///< By the kernel at creation (MADV_POPULATE_WRITE)
+    NKIT_PREFAULT_PARALLEL = 2  ///< By worker threads pinned to the target node
+} nkit_prefault_t;
+
+/** @brief Highest node count an arena placement policy can describe. */
+#define NKIT_ARENA_MAX_NODES 64
+
+/**
+ * @brief How an arena's pages are spread over NUMA nodes.
+ */
+typedef enum {
+    /** All pages on node_id (or on the nodes of nodemask); soft preference if binding fails. */
+    NKIT_POLICY_BIND = 0,
+    /** Pages round-robin over nodemask (MPOL_INTERLEAVE). */
+    NKIT_POLICY_INTERLEAVE = 1,
+    /**
+     * Stripes round-robin over nodemask, node n taking weights[n] stripes
+     * per round (e.g., proportional to memory bandwidth). A stripe is
+     * 2MB (or the hugepage size, if larger).
+     */
+    NKIT_POLICY_WEIGHTED_INTERLEAVE = 2,
+    /** Allocate on any node of nodemask, falling back to others (MPOL_PREFERRED_MANY). */
+    NKIT_POLICY_PREFERRED_MANY = 3
+} nkit_mem_policy_t;
+
+/**
+ * @brief Arena creation attributes. Zero-initialize for the defaults.
+ */
+typedef struct {
+    /**
+     * Page size to ask for. Without @c strict, a request that cannot be
+     * met falls back step by step: 1G -> 2M -> THP -> 4K.
+     */
+    nkit_page_size_t page_size;
+
+    /** Fail creation instead of falling back to a smaller backing. */
+    int strict;
+
+    /**
+     * Fault every page in (after the NUMA binding is applied) before the
+     * arena is returned, so the first real access does not take a page
+     * fault. A growable arena (nkit_arena_create_growable_ex) applies it
+     * to every chunk it maps.
+     */
+    nkit_prefault_t prefault;
+
+    /** NKIT_PREFAULT_PARALLEL: worker count (0 = one per CPU of the node). */
+    int prefault_threads;
+
+    /** Placement policy (default: bind to node_id). */
+    nkit_mem_policy_t policy;
+
+    /**
+     * Bit n selects node n. 0 means node_id for NKIT_POLICY_BIND and
+     * every node of the machine for the other policies.
+     */
+    uint64_t nodemask;
+
+    /** NKIT_POLICY_WEIGHTED_INTERLEAVE: stripes per round for each node (0 = 1). */
+    uint8_t weights[NKIT_ARENA_MAX_NODES];
+
+    /**
+     * NKIT_POLICY_BIND to node_id only (nodemask 0): while a pressure
+     * monitor reports node_id low on memory, map new chunks on the
+     * nearest node that is not, instead of exhausting node_id.
+     */
+    int spill;
+} nkit_arena_attr_t;
+
 /**
  * @brief Create a new memory arena bound to a specific NUMA node.
  * @param node_id The NUMA node to bind memory to (e.g., 0, 1).
@@ -21,22 +108,245 @@ typedef struct nkit_arena_s nkit_arena_t;
  */
 nkit_arena_t* nkit_arena_create(int node_id, size_t size);
 
+/**
+ * @brief Create an arena with explicit attributes (e.g., 1GB pages).
+ *
+ * The size is rounded up to 2MB, or to 1GB when backed by 1GB pages.
+ * Use nkit_arena_backing() to learn which backing was obtained.
+ *
+ * @param node_id The NUMA node to bind memory to.
+ * @param size    Total size of the arena in bytes.
+ * @param attr    Attributes, or NULL for the defaults.
+ * @return nkit_arena_t* Handle to the arena, or NULL on failure (including
+ *         a strict page-size request that could not be met).
+ */
+nkit_arena_t* nkit_arena_create_ex(int node_id, size_t size, const nkit_arena_attr_t* attr);
+
+/**
+ * @brief Create a growable arena that chains extra chunks on demand.
+ *
+ * Starts with a single chunk of @p chunk_size bytes (rounded up to 2MB).
+ * When the current chunk is full, nkit_arena_alloc() maps another
+ * node-bound chunk (hugepages first) instead of returning NULL.
+ * The bump-pointer fast path is unchanged.
+ *
+ * @param node_id    The NUMA node to bind every chunk to.
+ * @param chunk_size Growth granularity in bytes. Requests larger than a
+ *                   chunk get a dedicated chunk of their own size.
+ * @return nkit_arena_t* Handle to the arena, or NULL on failure.
+ */
+nkit_arena_t* nkit_arena_create_growable(int node_id, size_t chunk_size);
+
+/**
+ * @brief Create a growable arena with explicit attributes.
+ *
+ * Like nkit_arena_create_growable(), but every chunk, the first and each
+ * one mapped on growth, is mapped, placed and pre-faulted with @p attr.
+ * With @c spill set, each growth step re-checks memory pressure, so a
+ * busy arena moves its new chunks off a node once that node runs low.
+ *
+ * @param node_id    The NUMA node to bind every chunk to.
+ * @param chunk_size Growth granularity in bytes.
+ * @param attr       Attributes, or NULL for the defaults.
+ * @return nkit_arena_t* Handle to the arena, or NULL on failure.
+ */
+nkit_arena_t* nkit_arena_create_growable_ex(int node_id, size_t chunk_size,
+                                            const nkit_arena_attr_t* attr);
+
+/**
+ * @brief Create a fixed-size arena that many threads may allocate from.
+ *
+ * Each thread reserves a private sub-block (64KB at first, doubling up
+ * to 2MB for busy threads) with a single atomic fetch-add on the shared
+ * offset, then bump-allocates inside it without any synchronization.
+ * Requests larger than 64KB are reserved directly. Threads pinned to
+ * the node can thus share one hugepage-backed arena without locks.
+ *
+ * nkit_arena_used() reports reserved bytes (including the unused tails
+ * of per-thread sub-blocks). nkit_arena_reset() and nkit_arena_destroy()
+ * must not race with allocations.
+ *
+ * @param node_id The NUMA node to bind memory to.
+ * @param size    Total size of the arena in bytes.
+ * @return nkit_arena_t* Handle to the arena, or NULL on failure.
+ */
+nkit_arena_t* nkit_arena_create_concurrent(int node_id, size_t size);
+
+/**
+ * @brief File-backed arena attributes. Zero-initialize for the defaults.
+ */
+typedef struct {
+    /**
+     * Placement (policy, nodemask, weights) and prefault mode of the
+     * mapping. page_size, strict and spill are ignored: the file system
+     * decides the page size (hugetlbfs files get its huge pages).
+     */
+    nkit_arena_attr_t arena;
+
+    /**
+     * MAP_SHARED: writes, allocations included, reach the file and every
+     * process mapping it. The file is created if missing and grown to
+     * the arena size. Default: a private copy-on-write mapping.
+     */
+    int shared;
+
+    /** Map the file contents read-only (allocations still go after them). */
+    int readonly;
+} nkit_arena_file_attr_t;
+
+/**
+ * @brief Create an arena whose first bytes are the contents of a file.
+ *
+ * Meant for large read-mostly data sets loaded from disk, or shared
+ * tmpfs/hugetlbfs files. The contents count as allocated:
+ * nkit_arena_alloc() continues right after them, up to @p size bytes in
+ * total, and nkit_arena_reset() rewinds to that point, never into the
+ * file. Fixed-size: the arena does not grow.
+ *
+ * Page-cache pages are placed by whoever faults them, not by the
+ * mapping's policy, so place regular files with a prefault mode:
+ * NKIT_PREFAULT_PARALLEL reads the file ahead from threads on the CPUs
+ * of @p node_id that carry the arena's policy. Pages already cached on
+ * other nodes are then migrated where the kernel allows it (not while
+ * another process maps them).
+ *
+ * @param node_id Node for NKIT_POLICY_BIND and the prefault workers.
+ * @param path Regular file (on disk, tmpfs or hugetlbfs).
+ * @param size Total arena size; 0, or less than the file, maps just the file.
+ *             A writable shared file is extended to exactly @p size when
+ *             larger, and never changed otherwise.
+ * @param attr Attributes, or NULL for a private node-bound mapping.
+ * @return Handle, or NULL on failure (errno set).
+ */
+nkit_arena_t* nkit_arena_create_file(int node_id, const char* path, size_t size,
+                                     const nkit_arena_file_attr_t* attr);
+
+/**
+ * @brief Contents of a file-backed arena.
+ * @param bytes Receives the file length (may be NULL).
+ * @return Start of the contents, or NULL if the arena has none.
+ */
+void* nkit_arena_file_data(nkit_arena_t* arena, size_t* bytes);
+
+/**
+ * @brief Write a shared file-backed arena back to its file (msync).
+ * @return 0 on success or if there is nothing to write back, -1 on error.
+ */
+int nkit_arena_sync(nkit_arena_t* arena);
+
 /**
  * @brief Allocate memory from the arena.
  * This is a fast, lock-free bump-pointer allocation. 
  * It is NOT thread-safe by default (wrap it in a lock if sharing).
  * @param arena The arena handle.
  * @param size Bytes to allocate.
- * @return void* Pointer to the allocated memory, or NULL if arena is full.
+ * @return void* Pointer to the allocated memory, or NULL if arena is full
+ *         (or, for growable arenas, if a new chunk could not be mapped).
  */
 void* nkit_arena_alloc(nkit_arena_t* arena, size_t size);
 
+/**
+ * @brief Allocate with an explicit alignment and no size rounding.
+ *
+ * Only the gap needed to reach the alignment is skipped, so small
+ * objects pack densely; large alignments (e.g. 4KB for I/O buffers, or
+ * 2MB) are honoured on every chunk, including newly mapped ones.
+ *
+ * @param arena The arena handle.
+ * @param size  Bytes to allocate (not rounded up).
+ * @param align Any power of two (64 for AVX-512 vectors, 4096 for pages).
+ * @return Pointer aligned to @p align, or NULL if the arena is full or
+ *         @p align is not a power of two.
+ */
+void* nkit_arena_alloc_aligned(nkit_arena_t* arena, size_t size, size_t align);
+
+/**
+ * @brief Allocate exactly @p size bytes right after the previous object.
+ *
+ * No alignment and no padding: consecutive packed allocations form one
+ * dense array. Same as nkit_arena_alloc_aligned(arena, size, 1).
+ */
+void* nkit_arena_alloc_packed(nkit_arena_t* arena, size_t size);
+
+/**
+ * @brief Allocate an array of @p count elements (overflow-checked).
+ * @return Pointer aligned to @p align, or NULL on overflow or if full.
+ */
+void* nkit_arena_alloc_array(nkit_arena_t* arena, size_t count, size_t elem_size, size_t align);
+
+#ifdef __cplusplus
+#define NKIT_ALIGNOF(type) alignof(type)
+#else
+#define NKIT_ALIGNOF(type) _Alignof(type)
+#endif
+
+/** @brief Allocate one naturally aligned @p type from an arena (typed pointer). */
+#define NKIT_ARENA_NEW(arena, type) \
+    ((type*)nkit_arena_alloc_aligned((arena), sizeof(type), NKIT_ALIGNOF(type)))
+
+/** @brief Allocate a dense, naturally aligned array of @p count @p type. */
+#define NKIT_ARENA_NEW_ARRAY(arena, type, count) \
+    ((type*)nkit_arena_alloc_array((arena), (count), sizeof(type), NKIT_ALIGNOF(type)))
+
 /**
  * @brief Reset the arena (freeing all objects at once).
  * Does not return memory to the OS, just resets the pointer.
+ * Growable arenas rewind to their first chunk and keep the others
+ * mapped, so the next cycle reuses them without mmap/mbind.
  */
 void nkit_arena_reset(nkit_arena_t* arena);
 
+/**
+ * @brief Unmap the chunks a growable arena retains beyond its current one.
+ *
+ * Typically called right after nkit_arena_reset() to shrink the arena
+ * back to its first chunk. Has no effect on fixed-size arenas.
+ *
+ * @param arena The arena handle.
+ * @return Number of bytes returned to the OS.
+ */
+size_t nkit_arena_trim(nkit_arena_t* arena);
+
+/**
+ * @brief Saved allocation position of an arena (see nkit_arena_mark()).
+ * Treat as opaque; a zeroed mark is never valid.
+ */
+typedef struct {
+    void*  chunk;    ///< Chunk that was current
+    size_t used;     ///< Offset within that chunk
+    size_t retired;  ///< Bytes consumed in earlier chunks
+} nkit_arena_mark_t;
+
+/**
+ * @brief Checkpoint the arena's allocation position.
+ *
+ * Marks nest: take one before a scratch phase, rewind to it afterwards,
+ * and everything allocated in between is released at once while older
+ * allocations stay live. Not supported on concurrent arenas.
+ *
+ * @param arena The arena handle.
+ * @return The current position (a zeroed, invalid mark for NULL or
+ *         concurrent arenas).
+ */
+nkit_arena_mark_t nkit_arena_mark(nkit_arena_t* arena);
+
+/**
+ * @brief Free everything allocated since @p mark was taken.
+ *
+ * Growable arenas keep the chunks mapped past the mark for reuse, as with
+ * nkit_arena_reset(). If the burst dirtied more than 2MB beyond the mark,
+ * the deeper pages are handed back to the OS like nkit_arena_coalesce()
+ * does (the mapping stays valid), so scratch peaks don't inflate RSS
+ * for good. The first 2MB stay resident for the next burst.
+ *
+ * @param arena The arena handle.
+ * @param mark  A mark of this arena taken at or below the current
+ *              position (marks above an earlier rewind, reset or trim
+ *              are rejected).
+ * @return 0 on success, -1 for an invalid mark or concurrent arena.
+ */
+int nkit_arena_rewind(nkit_arena_t* arena, nkit_arena_mark_t mark);
+
 /**
  * @brief Destroy the arena and return memory to the OS.
  */
@@ -52,6 +362,163 @@ void nkit_arena_destroy(nkit_arena_t* arena);
  */
 int nkit_memory_migrate(void *ptr, size_t size, int target_node);
 
+/**
+ * @brief Report the NUMA node of every page of a range (via move_pages).
+ *
+ * Lets callers verify an arena's placement policy page by page. The
+ * range is expanded to whole system pages; nodes[i] describes the i-th
+ * one and must have room for all of them.
+ *
+ * @param ptr   Start of the range.
+ * @param size  Length in bytes.
+ * @param nodes Out: node of each page, or a negative errno for pages
+ *              that are not resident (-ENOENT) or not accessible.
+ * @return Number of pages reported, or -1 on failure (errno set).
+ */
+long nkit_memory_page_nodes(const void *ptr, size_t size, int *nodes);
+
+/** @brief Highest node count a residency histogram can describe. */
+#define NKIT_RESIDENCY_MAX_NODES 64
+
+/**
+ * @brief Per-node page histogram of a range.
+ */
+typedef struct {
+    /** Pages examined (the range expanded to whole system pages). */
+    size_t pages;
+
+    /** Resident pages per node. */
+    size_t per_node[NKIT_RESIDENCY_MAX_NODES];
+
+    /** Pages never faulted in or swapped out (-ENOENT). */
+    size_t not_present;
+
+    /** Pages whose node could not be determined (any other error). */
+    size_t unknown;
+
+    /** Node holding the most resident pages, or -1 if none is resident. */
+    int dominant_node;
+
+    /** CLOCK_MONOTONIC time the pages were sampled. */
+    uint64_t sampled_ns;
+} nkit_residency_t;
+
+/**
+ * @brief Count the pages of a range resident on each node.
+ *
+ * The kernel is queried with batched move_pages() calls. Results for
+ * recently queried ranges are cached: a query for the same range within
+ * max_age_ms returns the cached histogram (see sampled_ns) instead of
+ * walking the page tables again. Compare dominant_node or per_node
+ * against the intended node to detect drift after THP collapse, swap or
+ * automatic NUMA balancing.
+ *
+ * @param ptr        Start of the range.
+ * @param size       Length in bytes.
+ * @param out        Out: histogram.
+ * @param max_age_ms Oldest acceptable cached result (0 = always sample).
+ * @return 0 on success, -1 on failure (errno set).
+ */
+int nkit_memory_residency(const void *ptr, size_t size, nkit_residency_t *out,
+                          unsigned max_age_ms);
+
+/**
+ * @brief Drop cached residency results overlapping a range.
+ *
+ * Migrations done through libnumakit invalidate automatically; call this
+ * after moving or unmapping pages by other means.
+ */
+void nkit_memory_residency_invalidate(const void *ptr, size_t size);
+
+// =============================================================================
+// Asynchronous Page Migration
+// =============================================================================
+
+/**
+ * @brief Opaque handle for a background migration service.
+ *
+ * One worker thread drains a FIFO of migration requests, moving each
+ * range in move_pages() batches and pacing itself to a bandwidth limit
+ * so bulk moves do not saturate the interconnect.
+ */
+typedef struct nkit_migrator_s nkit_migrator_t;
+
+/**
+ * @brief Completion handle for one submitted range.
+ */
+typedef struct nkit_migration_s nkit_migration_t;
+
+/**
+ * @brief Migration service attributes. Zero-initialize for the defaults.
+ */
+typedef struct {
+    /** Pages per move_pages() call (0 = 512). */
+    size_t batch_pages;
+
+    /** Bandwidth cap in MB/s across all requests (0 = unlimited). */
+    double rate_limit_mbps;
+} nkit_migrator_attr_t;
+
+/**
+ * @brief Start a migration service.
+ * @param attr Optional attributes (NULL for defaults).
+ * @return Handle, or NULL if NUMA is unavailable or the thread fails to start.
+ */
+nkit_migrator_t* nkit_migrator_create(const nkit_migrator_attr_t* attr);
+
+/**
+ * @brief Queue a range for migration and return immediately.
+ *
+ * The range is expanded to whole system pages and must stay mapped
+ * until the request completes.
+ *
+ * @return Completion handle (release with nkit_migration_free), or NULL
+ *         on invalid arguments (errno = EINVAL) or allocation failure.
+ */
+nkit_migration_t* nkit_migrate_async(nkit_migrator_t* mig, void* ptr, size_t size, int target_node);
+
+/**
+ * @brief Non-blocking completion check.
+ * @return 1 if the request has been fully processed, 0 otherwise.
+ */
+int nkit_migration_done(const nkit_migration_t* m);
+
+/**
+ * @brief Block until the request has been fully processed.
+ * @return Number of pages that did not end up on the target node
+ *         (0 = complete success), or -1 if m is NULL.
+ */
+long nkit_migration_wait(nkit_migration_t* m);
+
+/**
+ * @brief Bytes now resident on the target node (so far, if still running).
+ */
+size_t nkit_migration_bytes_moved(const nkit_migration_t* m);
+
+/**
+ * @brief Per-page outcome of a completed request.
+ *
+ * status[i] is the node the i-th page ended up on, or a negative errno
+ * (-ENOENT: never faulted in, -EBUSY/-EFAULT/-ENOMEM/...: not moved).
+ *
+ * @param status Out: points at an array owned by the handle.
+ * @return Number of pages, or -1 if m is NULL or still running.
+ */
+long nkit_migration_status(const nkit_migration_t* m, const int** status);
+
+/**
+ * @brief Wait for the request (if still running) and release the handle.
+ */
+void nkit_migration_free(nkit_migration_t* m);
+
+/**
+ * @brief Finish every queued request, stop the worker and free the service.
+ *
+ * Outstanding handles stay valid and must still be released with
+ * nkit_migration_free.
+ */
+void nkit_migrator_destroy(nkit_migrator_t* mig);
+
 // =============================================================================
 // NUMA-Aware Slab Allocator
 // =============================================================================
@@ -62,9 +529,21 @@ int nkit_memory_migrate(void *ptr, size_t size, int target_node);
  * Provides O(1) fixed-size object allocation and deallocation using
  * a lock-free ring buffer (nkit_ring) as the internal free-list.
  * All memory is backed by an nkit_arena pinned to a specific NUMA node.
+ *
+ * Memory is organised in extents (a block of slots plus its own
+ * free-list). Fixed slabs have one extent; elastic slabs add extents on
+ * the same node when exhausted and can release idle ones.
  */
 typedef struct nkit_slab_s nkit_slab_t;
 
+/**
+ * @brief Upper bound on the number of extents of a single slab.
+ *
+ * Only bounded slabs hit it: the extents of an unbounded slab double in
+ * size, so the node runs out of memory long before the table fills.
+ */
+#define NKIT_SLAB_MAX_EXTENTS 64
+
 /**
  * @brief Create a slab allocator for fixed-size objects on a NUMA node.
  *
@@ -79,10 +558,35 @@ typedef struct nkit_slab_s nkit_slab_t;
  */
 nkit_slab_t *nkit_slab_create(int node_id, size_t obj_size, size_t capacity);
 
+/**
+ * @brief Create a slab that grows by node-local extents when exhausted.
+ *
+ * Starts like nkit_slab_create() with one extent of @p extent_capacity
+ * objects. When every extent is empty, the next allocation maps another
+ * hugepage-backed extent on the same node (up to @p max_extents) instead
+ * of failing. Idle extents can be handed back with nkit_slab_shrink().
+ *
+ * With @p max_extents 0 the slab is unbounded: each new extent holds
+ * twice as many objects as the one before (less if the node cannot fit
+ * that), so growth stops only when the node is out of memory.
+ *
+ * @param node_id         NUMA node to bind memory to.
+ * @param obj_size        Size of each object in bytes (will be aligned to 64B).
+ * @param extent_capacity Objects per extent, or in the first extent of an
+ *                        unbounded slab (must be a power of 2, >= 2).
+ * @param max_extents     Growth limit in extents of @p extent_capacity
+ *                        objects (> NKIT_SLAB_MAX_EXTENTS means
+ *                        NKIT_SLAB_MAX_EXTENTS), or 0 for unbounded.
+ * @return Pointer to the slab, or NULL on failure.
+ */
+nkit_slab_t *nkit_slab_create_elastic(int node_id, size_t obj_size, size_t extent_capacity,
+                                      size_t max_extents);
+
 /**
  * @brief Allocate a single object from the slab. O(1), lock-free.
  * @param slab The slab handle.
- * @return Pointer to an object-sized block, or NULL if the slab is exhausted.
+ * @return Pointer to an object-sized block, or NULL if the slab is exhausted
+ *         (for elastic slabs: and no further extent could be added).
  */
 void *nkit_slab_alloc(nkit_slab_t *slab);
 
@@ -93,6 +597,38 @@ void *nkit_slab_alloc(nkit_slab_t *slab);
  */
 void nkit_slab_free(nkit_slab_t *slab, void *ptr);
 
+/**
+ * @brief Allocate up to @p n objects from the slab in one call.
+ *
+ * Used by caching layers to refill in batches.
+ * @param slab The slab handle.
+ * @param objs Output array with room for at least @p n pointers.
+ * @param n    Number of objects requested.
+ * @return Number of objects actually written to @p objs (0 if exhausted).
+ */
+size_t nkit_slab_alloc_bulk(nkit_slab_t *slab, void **objs, size_t n);
+
+/**
+ * @brief Return @p n objects to the slab in one call.
+ * @param slab The slab handle.
+ * @param objs Pointers previously returned by this slab.
+ * @param n    Number of pointers in @p objs.
+ */
+void nkit_slab_free_bulk(nkit_slab_t *slab, void *const *objs, size_t n);
+
+/**
+ * @brief Release fully-free extents of an elastic slab back to the OS.
+ *
+ * An extent is released only if every one of its objects is free. Its
+ * pages are returned via nkit_arena_coalesce() while the mapping is kept,
+ * so a later growth step re-activates it without mmap/mbind. The first
+ * extent is always kept.
+ *
+ * @param slab The slab handle.
+ * @return Number of extents released (0 for fixed slabs).
+ */
+size_t nkit_slab_shrink(nkit_slab_t *slab);
+
 /**
  * @brief Destroy the slab and release all backing memory.
  * @param slab The slab handle.
@@ -111,7 +647,7 @@ size_t nkit_slab_available(nkit_slab_t *slab);
 /**
  * @brief Query the total capacity of the slab.
  * @param slab The slab handle.
- * @return Total number of object slots.
+ * @return Total number of object slots in active (non-released) extents.
  */
 size_t nkit_slab_capacity(nkit_slab_t *slab);
 
@@ -148,7 +684,7 @@ size_t nkit_arena_used(nkit_arena_t *arena);
 /**
  * @brief Query the total capacity of the arena in bytes.
  * @param arena The arena handle.
- * @return Total arena size.
+ * @return Total arena size (sum of all chunks for growable arenas).
  */
 size_t nkit_arena_size(nkit_arena_t *arena);
 
@@ -159,59 +695,469 @@ size_t nkit_arena_size(nkit_arena_t *arena);
  */
 int nkit_arena_is_huge(nkit_arena_t *arena);
 
+/**
+ * @brief Query the backing the arena actually got.
+ *
+ * For growable arenas this is the weakest backing among all chunks.
+ * NKIT_PAGE_THP means the kernel accepted the hint; khugepaged may
+ * still leave parts on 4KB pages.
+ *
+ * @param arena The arena handle.
+ * @return One of NKIT_PAGE_4K / _THP / _2M / _1G (NKIT_PAGE_DEFAULT for NULL).
+ */
+nkit_page_size_t nkit_arena_backing(nkit_arena_t *arena);
+
+/**
+ * @brief Page size in bytes matching nkit_arena_backing() (TLB reach per entry).
+ * @param arena The arena handle.
+ * @return 4096, 2MB or 1GB; 0 for NULL.
+ */
+size_t nkit_arena_page_size(nkit_arena_t *arena);
+
+/**
+ * @brief Time spent pre-faulting the arena's memory.
+ * @param arena The arena handle.
+ * @return Nanoseconds, summed over all chunks (0 if prefault is off).
+ */
+uint64_t nkit_arena_prefault_ns(nkit_arena_t *arena);
+
 /**
  * @brief Opaque handle for a NUMA-aware multi-size-class memory pool.
  *
- * Provides a general-purpose allocator that leverages per-node slab
- * allocators for multiple size classes (e.g., 32B up to 16KB).
+ * Provides a general-purpose allocator that leverages per-node elastic
+ * slab allocators for multiple size classes (by default 36 quarter-power
+ * steps from 16B up to 16KB).
+ * Larger requests are served page-granular from per-node 2MB
+ * hugepage-backed runs, with a per-node cache of freed spans.
  * Allocations are automatically serviced from memory local to the
  * calling thread's NUMA node.
+ *
+ * Each thread keeps a small per-size-class cache (magazine) in front of
+ * the node slabs, refilled and flushed in batches, so a typical
+ * alloc/free pair touches only thread-private memory.
  */
 typedef struct nkit_mempool_s nkit_mempool_t;
 
+/** @brief Maximum number of size classes a pool may have. */
+#define NKIT_MEMPOOL_MAX_CLASSES 64
+
+/** @brief Largest size class a pool may have; bigger requests are large objects. */
+#define NKIT_MEMPOOL_MAX_SMALL 16384
+
 /**
  * @brief Create a new global NUMA-aware memory pool.
  *
- * Discovers the system topology and initializes required slabs
- * internally across all NUMA nodes.
+ * Discovers the system topology and uses the default size classes:
+ * 16-byte steps up to 128B, then four classes per power of two up to
+ * 16KB (at most 20% internal fragmentation). The slab of a class on a
+ * node is created the first time that node allocates from it.
  *
  * @return Pointer to the new memory pool, or NULL on failure.
  */
 nkit_mempool_t* nkit_mempool_create(void);
 
+/**
+ * @brief Create a memory pool with a custom set of size classes.
+ *
+ * Lets applications match the classes to their dominant object sizes
+ * instead of the default quarter-power steps. Sizes are rounded up to
+ * a multiple of 16 bytes and must be strictly increasing; requests
+ * above the largest class are served by the large-object tier (whole
+ * pages), so the set should cover every small size in use.
+ *
+ * @param class_sizes Ascending slot sizes in bytes (at most NKIT_MEMPOOL_MAX_SMALL).
+ * @param num_classes Number of entries (1 to NKIT_MEMPOOL_MAX_CLASSES).
+ * @return Pointer to the new memory pool, or NULL on invalid input or failure.
+ */
+nkit_mempool_t* nkit_mempool_create_ex(const size_t* class_sizes, size_t num_classes);
+
 /**
  * @brief Allocate memory from the memory pool.
  *
- * Automatically selects a local slab based on the current NUMA node
- * and requested size. Uses an O(1) lock-free allocation if available.
+ * Pops from the calling thread's magazine for the requested size class.
+ * When the magazine is empty it is refilled with a batch from the slab
+ * of the thread's current NUMA node (the only point where the node is
+ * looked up).
+ *
+ * Requests above the largest size class (16KB) are rounded up to whole
+ * pages and carved from a node-bound, hugepage-backed run of the
+ * caller's node; recently freed spans are reused first.
  *
  * @param pool The memory pool handle.
  * @param size Bytes to allocate.
- * @return Pointer to the allocated memory, or NULL if out of memory
- *         or the size exceeds the maximum supported size class.
+ * @return Pointer to the allocated memory (64-byte aligned for large
+ *         blocks), or NULL if out of memory.
  */
 void* nkit_mempool_alloc(nkit_mempool_t* pool, size_t size);
 
+/**
+ * @brief Allocate from the memory pool with an explicit alignment.
+ *
+ * Small requests take the first size class that holds @p size and is
+ * naturally aligned to @p align (each class is aligned to its largest
+ * power-of-two divisor, up to 4KB), so aligned_alloc(128, 32) costs one
+ * 128-byte slot. Only when no class qualifies does the request go to the
+ * large-object tier.
+ * Freed with nkit_mempool_free() like any other block.
+ *
+ * @param pool The memory pool handle.
+ * @param size Size in bytes.
+ * @param align Power of two, at most 2048.
+ * @return Pointer to the block, or NULL on failure or invalid alignment.
+ */
+void* nkit_mempool_alloc_aligned(nkit_mempool_t* pool, size_t size, size_t align);
+
 /**
  * @brief Return memory to the memory pool.
  *
  * The memory block must have been previously allocated by `nkit_mempool_alloc`
  * from the SAME pool. Deallocation is O(1) lock-free.
  *
+ * Blocks homed on the thread's cache node are pushed onto its magazine
+ * (a full magazine spills half of its objects back to the slab).
+ * Blocks from other nodes are batched per owner node and posted to that
+ * node's remote-free inbox, so the owner's slab ring is never touched
+ * across the interconnect; the owner drains its inbox lazily on its next
+ * magazine refill.
+ *
+ * Large blocks go back to their node's span cache (coalesced with free
+ * neighbours); past a per-node cap their pages are returned to the OS.
+ *
  * @param pool The memory pool handle.
  * @param ptr Pointer previously returned by `nkit_mempool_alloc`.
  */
 void nkit_mempool_free(nkit_mempool_t* pool, void* ptr);
 
+/**
+ * @brief Return every object cached by the calling thread to the slabs.
+ *
+ * Thread caches are flushed automatically when a thread exits; call this
+ * to release them earlier (e.g. before a long idle period).
+ *
+ * @param pool The memory pool handle.
+ */
+void nkit_mempool_flush(nkit_mempool_t* pool);
+
+/**
+ * @brief Return idle slab extents of the pool to the OS.
+ *
+ * Size classes grow by node-local extents under load. This flushes the
+ * calling thread's cache, drains the remote-free inboxes and releases
+ * every extent whose objects are all free, so resident memory follows
+ * the live working set. Cached large spans stay reusable but drop their
+ * pages. Objects cached by other threads keep their extents alive.
+ *
+ * @param pool The memory pool handle.
+ * @return Number of extents released.
+ */
+size_t nkit_mempool_trim(nkit_mempool_t* pool);
+
+/**
+ * @brief Usable bytes of a block handed out by the pool.
+ *
+ * @param pool The memory pool handle.
+ * @param ptr Any pointer (may be foreign).
+ * @return Bytes available from @p ptr to the end of its block, or 0 if
+ *         @p ptr was not allocated by this pool.
+ */
+size_t nkit_mempool_usable_size(nkit_mempool_t* pool, const void* ptr);
+
+/**
+ * @brief Bytes actually reserved for a request of 'size' bytes.
+ *
+ * The size of the class that serves it, or the page-rounded span for
+ * large objects. Useful to size objects so they fill their class.
+ *
+ * @param pool The memory pool handle.
+ * @param size Requested bytes.
+ * @return Usable bytes of such an allocation, or 0 if size is 0.
+ */
+size_t nkit_mempool_class_size(nkit_mempool_t* pool, size_t size);
+
+/**
+ * @brief Number of blocks freed by a thread on a node other than their own.
+ *
+ * Counted when a batch is posted to the owner's inbox, so frees still
+ * pending in a live thread's cache (see nkit_mempool_flush) are not
+ * included yet.
+ *
+ * @param pool The memory pool handle.
+ * @return Total remote frees since the pool was created.
+ */
+uint64_t nkit_mempool_remote_frees(nkit_mempool_t* pool);
+
 /**
  * @brief Destroy the memory pool and release all underlying memory.
  *
- * Any outstanding allocations are invalidated.
+ * Any outstanding allocations are invalidated. Threads that used the
+ * pool must not call into it concurrently with (or after) destruction.
  *
  * @param pool The memory pool handle.
  */
 void nkit_mempool_destroy(nkit_mempool_t* pool);
 
+/**
+ * @brief Fork handlers for a pool that serves malloc().
+ *
+ * A lock held by another thread at fork() would stay locked forever in
+ * the child. Register these with pthread_atfork(): prefork takes every
+ * lock of the pool's alloc/free paths (and of the slabs under it), the
+ * parent releases them, and the child re-initializes them.
+ */
+void nkit_mempool_prefork(nkit_mempool_t* pool);
+void nkit_mempool_postfork_parent(nkit_mempool_t* pool);
+void nkit_mempool_postfork_child(nkit_mempool_t* pool);
+
+// =============================================================================
+// Memory Pressure
+// =============================================================================
+
+/**
+ * @brief Opaque handle for a node free-memory monitor.
+ *
+ * A background thread samples nkit_topo_node_memory() for every node
+ * and classifies each one by its free fraction. Level changes are
+ * published process-wide (nkit_pressure_level(), arenas with
+ * nkit_arena_attr_t::spill) and delivered to registered callbacks; a
+ * node getting worse also triggers reclaim on the watched allocators.
+ * At most one monitor runs at a time.
+ */
+typedef struct nkit_pressure_s nkit_pressure_t;
+
+/**
+ * @brief Pressure level of a node.
+ */
+typedef enum {
+    NKIT_PRESSURE_NONE     = 0, /**< Enough free memory (or no monitor running). */
+    NKIT_PRESSURE_LOW      = 1, /**< Below low_free_pct: reclaim caches. */
+    NKIT_PRESSURE_CRITICAL = 2  /**< Below critical_free_pct: avoid the node. */
+} nkit_pressure_level_t;
+
+/**
+ * @brief Monitor attributes. Zero-initialize for the defaults.
+ */
+typedef struct {
+    /** Free memory (% of the node) below which a node is LOW (0 = 10). */
+    double low_free_pct;
+
+    /** Free memory (% of the node) below which a node is CRITICAL (0 = 3, < 0 = never). */
+    double critical_free_pct;
+
+    /** Sampling period in milliseconds (0 = 100). */
+    unsigned interval_ms;
+} nkit_pressure_attr_t;
+
+/**
+ * @brief Called from the monitor thread whenever a node changes level.
+ */
+typedef void (*nkit_pressure_cb_t)(int node, nkit_pressure_level_t level, void *arg);
+
+/**
+ * @brief Start the monitor. Requires nkit_init().
+ *
+ * A node leaves a level only once its free memory is 25% above that
+ * level's threshold, so a node hovering at the edge does not flap.
+ * The first sample is taken one interval after creation, once
+ * callbacks and watches are in place; nkit_pressure_poll() samples
+ * earlier. Callbacks and reclaim run with the monitor locked and must
+ * not call back into it.
+ *
+ * @param attr Attributes, or NULL for the defaults.
+ * @return Monitor handle, or NULL on failure or if one is already running.
+ */
+nkit_pressure_t *nkit_pressure_create(const nkit_pressure_attr_t *attr);
+
+/**
+ * @brief Register a callback for level changes.
+ * @return 0 on success, -1 on failure.
+ */
+int nkit_pressure_on_change(nkit_pressure_t *mon, nkit_pressure_cb_t cb, void *arg);
+
+/**
+ * @brief Trim and coalesce an idle arena when its node comes under pressure.
+ *
+ * The monitor thread reclaims the arena (nkit_arena_trim() and
+ * nkit_arena_coalesce()) without synchronizing with its owner: watch
+ * arenas only while nobody allocates from them, e.g. scratch arenas
+ * parked between phases, and unwatch before using them again.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int nkit_pressure_watch_arena(nkit_pressure_t *mon, nkit_arena_t *arena);
+
+/**
+ * @brief Shrink a slab (nkit_slab_shrink()) when its node comes under pressure.
+ * @return 0 on success, -1 on failure.
+ */
+int nkit_pressure_watch_slab(nkit_pressure_t *mon, nkit_slab_t *slab);
+
+/**
+ * @brief Trim a memory pool (nkit_mempool_trim()) when any node comes under pressure.
+ * @return 0 on success, -1 on failure.
+ */
+int nkit_pressure_watch_mempool(nkit_pressure_t *mon, nkit_mempool_t *pool);
+
+/**
+ * @brief Stop watching an arena, slab or pool.
+ *
+ * On return the monitor no longer touches @p obj, even if a reclaim
+ * pass was running.
+ *
+ * @return 0 if @p obj was watched, -1 otherwise.
+ */
+int nkit_pressure_unwatch(nkit_pressure_t *mon, const void *obj);
+
+/**
+ * @brief Sample every node now, in the calling thread.
+ *
+ * Level changes, callbacks and reclaim happen as on a periodic sample.
+ *
+ * @return Number of nodes whose level changed, or -1 on failure.
+ */
+int nkit_pressure_poll(nkit_pressure_t *mon);
+
+/**
+ * @brief Current level of a node (one atomic load).
+ * @return The level, NKIT_PRESSURE_NONE if no monitor runs or the node is invalid.
+ */
+nkit_pressure_level_t nkit_pressure_level(int node);
+
+/**
+ * @brief Stop the monitor thread and free it. Every node returns to NONE.
+ */
+void nkit_pressure_destroy(nkit_pressure_t *mon);
+
+// =============================================================================
+// Memory Telemetry
+// =============================================================================
+
+/** @brief Highest node count a telemetry snapshot can describe. */
+#define NKIT_STATS_MAX_NODES 64
+
+/**
+ * @brief Memory accounting of one NUMA node, across every allocator.
+ */
+typedef struct {
+    /** Bytes mapped by arenas bound to the node (incl. slab extents and mempool runs). */
+    uint64_t bytes_mapped;
+
+    /** Part of bytes_mapped on hugepages (hugetlbfs 2MB/1GB or THP-advised). */
+    uint64_t bytes_huge;
+
+    /** Part of bytes_mapped on base (4KB) pages. */
+    uint64_t bytes_4k;
+
+    /**
+     * Bytes of slab objects (including mempool size classes, and the
+     * objects parked in mempool thread caches) and mempool large blocks
+     * currently handed out. Bump allocations are reported per arena by
+     * nkit_arena_used() instead.
+     */
+    uint64_t bytes_in_use;
+
+    /** nkit_mempool_alloc() calls this node could not serve locally. */
+    uint64_t remote_fallbacks;
+
+    /** Slab allocations that found no free slot and could not grow. */
+    uint64_t slab_exhausted;
+} nkit_node_mem_stats_t;
+
+/**
+ * @brief Library-wide snapshot of nkit_node_mem_stats_t.
+ */
+typedef struct {
+    int num_nodes;                                     ///< Valid entries in nodes[]
+    nkit_node_mem_stats_t nodes[NKIT_STATS_MAX_NODES]; ///< Per node
+    nkit_node_mem_stats_t total;                       ///< Sum over all nodes
+} nkit_mem_stats_t;
+
+/**
+ * @brief Copy the current per-node memory counters.
+ *
+ * Counters are kept in partitioned counters with one cache-line slot per
+ * node, updated where memory is mapped, unmapped or handed out. Reading
+ * them never stops the allocators, so the snapshot is consistent per
+ * counter but not across counters. Poll it to alert before a node runs
+ * out (growing remote_fallbacks or slab_exhausted are early signs).
+ *
+ * @param out Snapshot to fill.
+ * @return 0 on success, -1 if out is NULL.
+ */
+int nkit_mem_stats_snapshot(nkit_mem_stats_t* out);
+
+// =============================================================================
+// Replicated Read-Only Regions
+// =============================================================================
+
+/**
+ * @brief Opaque handle for a read-mostly buffer replicated on every node.
+ *
+ * Each NUMA node gets its own copy in a node-bound arena, so readers
+ * never cross the interconnect. Updates are published RCU-style: a new
+ * set of replicas is built, swapped in atomically, and the old set is
+ * freed once every reader that could still see it has left.
+ */
+typedef struct nkit_replica_s nkit_replica_t;
+
+/**
+ * @brief A read-side critical section on a replica.
+ */
+typedef struct {
+    const void* data;  ///< Replica local to the node the reader ran on
+    size_t      size;  ///< Size of that version in bytes
+    int         node;  ///< Node 'data' lives on
+    int         slot;  ///< Internal: reader counter to release
+} nkit_replica_read_t;
+
+/**
+ * @brief Replicate a built buffer onto every NUMA node.
+ * @param data Contents to copy (the caller keeps ownership).
+ * @param size Length in bytes.
+ * @return Handle, or NULL on invalid input or allocation failure.
+ */
+nkit_replica_t* nkit_replica_create(const void* data, size_t size);
+
+/**
+ * @brief Enter a read-side critical section and get the local replica.
+ *
+ * Two atomic increments/decrements on a node-local counter; no locks.
+ * The returned data stays valid, and unchanged, until
+ * nkit_replica_read_unlock(), even if a new version is published.
+ * Sections may nest but must not call nkit_replica_publish().
+ *
+ * @param rep  Replica handle.
+ * @param read Out: section state, passed back to the unlock.
+ * @return read->data, or NULL if rep or read is NULL.
+ */
+const void* nkit_replica_read_lock(nkit_replica_t* rep, nkit_replica_read_t* read);
+
+/**
+ * @brief Leave a read-side critical section.
+ */
+void nkit_replica_read_unlock(nkit_replica_t* rep, nkit_replica_read_t* read);
+
+/**
+ * @brief Replace the contents on every node.
+ *
+ * Builds fresh replicas (the size may change), swaps them in, then
+ * waits for readers of the previous version before freeing it.
+ * Concurrent publishers are serialized.
+ *
+ * @return 0 on success, -1 on invalid input or allocation failure (the
+ *         current version stays in place).
+ */
+int nkit_replica_publish(nkit_replica_t* rep, const void* data, size_t size);
+
+/**
+ * @brief Number of versions published since creation (starts at 0).
+ */
+uint64_t nkit_replica_version(nkit_replica_t* rep);
+
+/**
+ * @brief Free every replica. No reader may be inside a critical section.
+ */
+void nkit_replica_destroy(nkit_replica_t* rep);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,9 @@ extern "C" {
 #include "sync.h"
 #include "topology.h"
 #include "structs/ring_buffer.h"
+#include "structs/spsc_ring.h"
+#include "structs/typed_ring.h"
+#include "structs/mpsc_queue.h"
 #include "structs/hash_table.h"
 #include "structs/skip_list.h"
 
@@ -98,13 +98,16 @@ int nkit_current_cpu(void);
 
 /**
  * @brief Send a data pointer to a target NUMA node.
- * Thread-safe (Multi-Producer).
+ * Thread-safe (Multi-Producer). The mailbox is unbounded, so a send
+ * only fails if the target node cannot provide another segment.
+ * @return 0 on success, -1 on invalid node, -2 if out of memory.
  */
 int nkit_send(int target_node, void *data);
 
 /**
  * @brief Process pending messages for the CURRENT node.
- * Lock-Free Consumer.
+ * Lock-Free Consumer. One thread per node drains at a time: a call made
+ * while another thread of the node is draining returns 0.
  * @param handler Function to call for each message.
  * @param limit Maximum number of messages to process (0 = unlimited,
  * dangerous!).
@@ -112,6 +115,15 @@ int nkit_send(int target_node, void *data);
  */
 size_t nkit_process_local(void (*handler)(void *), size_t limit);
 
+/**
+ * @brief Like nkit_process_local, but sleeps until a message arrives.
+ * Parks on the mailbox's futex instead of polling; nkit_send wakes it.
+ * @param timeout_ms Maximum time to wait, < 0 to wait indefinitely.
+ * @return Number of messages processed (0 on timeout).
+ */
+size_t nkit_process_local_wait(void (*handler)(void *), size_t limit,
+                               int timeout_ms);
+
 // -----------------------------------------------------------------------------
 // Direct Pinning API (Native Backend)
 // -----------------------------------------------------------------------------
@@ -167,6 +179,10 @@ int nkit_pool_submit_local(nkit_pool_t *pool, void (*func)(void *),
 
 /**
  * @brief Submit a task to a specific, explicit NUMA node.
+ *
+ * Idle workers sleep until a submit wakes them. If no worker of
+ * @p target_node is parked, the nearest parked worker of another node
+ * is woken to steal the task.
  */
 int nkit_pool_submit_to_node(nkit_pool_t *pool, int target_node,
                              void (*func)(void *), void *arg);
@@ -0,0 +1,81 @@
+/**
+ * @file mpsc_queue.h
+ * @brief Unbounded NUMA-aware multi-producer / single-consumer queue.
+ */
+
+#ifndef NKIT_MPSC_QUEUE_H
+#define NKIT_MPSC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief Opaque handle for an unbounded MPSC queue.
+ *
+ * Items are stored in a linked list of fixed-size segments. Producers
+ * claim a slot in the tail segment with one atomic add; the thread that
+ * fills a segment links the next one. Segments come from an unbounded
+ * elastic slab on the consumer's node and go back to it once drained. A burst grows
+ * the queue until the node runs out of memory instead of failing, and
+ * steady traffic recycles the same node-local segments without calling
+ * malloc.
+ *
+ * Any number of threads may push. Only one thread at a time may pop.
+ */
+typedef struct nkit_mpsc_s nkit_mpsc_t;
+
+/**
+ * @brief Create a queue whose segments live on a NUMA node.
+ * @param node_id The NUMA node of the consumer.
+ * @return Pointer to the queue, or NULL on failure.
+ */
+nkit_mpsc_t* nkit_mpsc_create(int node_id);
+
+/**
+ * @brief Destroy the queue and release every segment.
+ * Items still queued are dropped.
+ */
+void nkit_mpsc_destroy(nkit_mpsc_t* q);
+
+/**
+ * @brief Append an item (Multi-Producer Safe).
+ * @return 0 on success, -1 if a new segment could not be allocated
+ *         (the node is out of memory).
+ */
+int nkit_mpsc_push(nkit_mpsc_t* q, void* item);
+
+/**
+ * @brief Wake the consumer if it is parked in nkit_mpsc_pop_wait().
+ * Call after one or more pushes; a fence and a load when nobody sleeps.
+ */
+void nkit_mpsc_notify(nkit_mpsc_t* q);
+
+/**
+ * @brief Remove the oldest item (consumer only).
+ * An item whose producer is still writing it counts as not yet queued.
+ * @return true if an item was popped, false if the queue is empty.
+ */
+bool nkit_mpsc_pop(nkit_mpsc_t* q, void** item);
+
+/**
+ * @brief Remove up to 'n' items in order (consumer only).
+ * @return Number of items popped.
+ */
+size_t nkit_mpsc_pop_burst(nkit_mpsc_t* q, void** items, size_t n);
+
+/**
+ * @brief Pop, sleeping until a producer pushes and notifies (consumer only).
+ * @param timeout_ms Maximum time to wait, < 0 to wait indefinitely.
+ * @return true if an item was popped, false on timeout.
+ */
+bool nkit_mpsc_pop_wait(nkit_mpsc_t* q, void** item, int timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NKIT_MPSC_QUEUE_H
@@ -13,6 +13,8 @@ extern "C" {
 #include <stdalign.h>
 #include <sched.h>
 
+#include <numakit/sync.h>
+
 // Cache line size (64 bytes on x86/ARM, 128 to be safe against prefetchers)
 #define NKIT_CACHE_LINE 128
 
@@ -26,8 +28,10 @@ typedef struct {
 } nkit_cell_t;
 
 /**
- * @brief Lock-Free Ring Buffer (SPSC).
+ * @brief Lock-Free Ring Buffer (MPMC).
  * optimized to prevent False Sharing between Producer and Consumer.
+ * For a link with exactly one producer and one consumer, nkit_spsc_t
+ * (structs/spsc_ring.h) avoids the CAS and per-cell sequence numbers.
  */
 typedef struct {
     // -------------------------------------------------------------------------
@@ -46,6 +50,12 @@ typedef struct {
     // Padding to ensure read-only fields are separated
     char pad2[NKIT_CACHE_LINE - sizeof(atomic_size_t)];
 
+    // -------------------------------------------------------------------------
+    // Parked Consumers (written only when a consumer sleeps or is woken)
+    // -------------------------------------------------------------------------
+    alignas(NKIT_CACHE_LINE) nkit_eventcount_t readable;
+    char pad3[NKIT_CACHE_LINE - sizeof(nkit_eventcount_t)];
+
     // -------------------------------------------------------------------------
     // Read-Only Fields (Shared)
     // -------------------------------------------------------------------------
@@ -70,6 +80,24 @@ nkit_ring_t* nkit_ring_create(int node_id, size_t capacity);
  */
 void nkit_ring_free(nkit_ring_t* ring);
 
+/**
+ * @brief Pop, sleeping until an item arrives (Multi-Consumer Safe).
+ * Spins briefly, then parks on a futex until a producer calls
+ * nkit_ring_notify(). Only pushes followed by a notify wake sleepers.
+ * @param timeout_ms Maximum time to wait, < 0 to wait indefinitely.
+ * @return true if an item was popped, false on timeout.
+ */
+bool nkit_ring_pop_wait(nkit_ring_t* ring, void** item, int timeout_ms);
+
+/**
+ * @brief Wake one consumer parked in nkit_ring_pop_wait(), if any.
+ * Call after a push (or a bulk push). Costs a fence and one load of a
+ * cache line nobody writes while no consumer is parked.
+ */
+static inline void nkit_ring_notify(nkit_ring_t* ring) {
+    nkit_ec_notify(&ring->readable);
+}
+
 /**
  * @brief Lock-Free Push (Multi-Producer Safe).
  * @return true if successful, false if full.
@@ -148,6 +176,138 @@ static inline bool nkit_ring_pop(nkit_ring_t* ring, void** item) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Bulk / Burst Operations
+// -----------------------------------------------------------------------------
+// A batch claims all of its slots with a single CAS on 'head' (or 'tail'),
+// then fills (or drains) them one cell at a time. A slot that was claimed
+// is not necessarily committed yet: each cell is still gated by its
+// sequence number, so a batch may briefly wait for the thread that owned
+// the slot on the previous lap (or is still writing it) to finish.
+// Batches and single-item calls can be mixed freely on the same ring.
+
+/**
+ * @brief Wait until a claimed cell reaches the expected sequence number.
+ */
+static inline void _nkit_ring_wait_cell(nkit_cell_t* cell, size_t seq) {
+    unsigned spins = 0;
+    while (atomic_load_explicit(&cell->sequence, memory_order_acquire) != seq) {
+        // The owner may have been preempted: give it the CPU now and then
+        if (++spins % 128 == 0) {
+            sched_yield();
+        } else {
+            nkit_cpu_pause();
+        }
+    }
+}
+
+static inline size_t _nkit_ring_enqueue(nkit_ring_t* ring, void* const* items,
+                                        size_t n, bool burst) {
+    if (n == 0) return 0;
+
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t count;
+
+    for (;;) {
+        size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        size_t used = head - tail;
+
+        // Consumers moved past our stale 'head': reload it
+        if (used > ring->capacity) {
+            head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+            continue;
+        }
+
+        size_t space = ring->capacity - used;
+        count = (n <= space) ? n : (burst ? space : 0);
+        if (count == 0) return 0;
+
+        // Claim [head, head + count) in one step
+        if (atomic_compare_exchange_weak_explicit(&ring->head, &head, head + count,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t pos = head + i;
+        nkit_cell_t* cell = &ring->cells[pos & ring->mask];
+
+        // Slot free once last lap's consumer has committed it (seq == pos)
+        _nkit_ring_wait_cell(cell, pos);
+        cell->data = items[i];
+        atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    }
+    return count;
+}
+
+static inline size_t _nkit_ring_dequeue(nkit_ring_t* ring, void** items,
+                                        size_t n, bool burst) {
+    if (n == 0) return 0;
+
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t count;
+
+    for (;;) {
+        // 'head' never falls behind 'tail', and it is loaded after it
+        size_t head  = atomic_load_explicit(&ring->head, memory_order_acquire);
+        size_t avail = head - tail;
+
+        count = (n <= avail) ? n : (burst ? avail : 0);
+        if (count == 0) return 0;
+
+        if (atomic_compare_exchange_weak_explicit(&ring->tail, &tail, tail + count,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t pos = tail + i;
+        nkit_cell_t* cell = &ring->cells[pos & ring->mask];
+
+        // Data ready once its producer has committed it (seq == pos + 1)
+        _nkit_ring_wait_cell(cell, pos + 1);
+        items[i] = cell->data;
+        atomic_store_explicit(&cell->sequence, pos + ring->mask + 1, memory_order_release);
+    }
+    return count;
+}
+
+/**
+ * @brief Push all 'n' items or none (Multi-Producer Safe).
+ * Claims every slot with one atomic operation.
+ * @return n on success, 0 if fewer than n slots are free.
+ */
+static inline size_t nkit_ring_push_bulk(nkit_ring_t* ring, void* const* items, size_t n) {
+    return _nkit_ring_enqueue(ring, items, n, false);
+}
+
+/**
+ * @brief Push as many of the 'n' items as fit (Multi-Producer Safe).
+ * @return Number of items pushed (0 if the ring is full).
+ */
+static inline size_t nkit_ring_push_burst(nkit_ring_t* ring, void* const* items, size_t n) {
+    return _nkit_ring_enqueue(ring, items, n, true);
+}
+
+/**
+ * @brief Pop exactly 'n' items or none (Multi-Consumer Safe).
+ * Items come out in ring order.
+ * @return n on success, 0 if fewer than n items are queued.
+ */
+static inline size_t nkit_ring_pop_bulk(nkit_ring_t* ring, void** items, size_t n) {
+    return _nkit_ring_dequeue(ring, items, n, false);
+}
+
+/**
+ * @brief Pop up to 'n' items (Multi-Consumer Safe).
+ * @return Number of items popped (0 if the ring is empty).
+ */
+static inline size_t nkit_ring_pop_burst(nkit_ring_t* ring, void** items, size_t n) {
+    return _nkit_ring_dequeue(ring, items, n, true);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,148 @@
+#ifndef NKIT_SPSC_RING_H
+#define NKIT_SPSC_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include <numakit/structs/ring_buffer.h>
+
+/**
+ * @brief Wait-Free Single-Producer / Single-Consumer Ring.
+ *
+ * For a link between exactly two threads (e.g. two pinned pipeline
+ * stages). There are no CAS loops and no per-slot sequence numbers:
+ * each side owns one index, publishes it with a release store, and
+ * keeps a private copy of the other side's index. The shared index
+ * cache line is only read when that copy says the ring looks full
+ * (producer) or empty (consumer). Slots are bare 8-byte pointers.
+ *
+ * Calling push from more than one thread, or pop from more than one
+ * thread, is undefined. Use nkit_ring_t for multi-producer/consumer.
+ */
+typedef struct {
+    // -------------------------------------------------------------------------
+    // Producer Cache Line
+    // -------------------------------------------------------------------------
+    alignas(NKIT_CACHE_LINE) atomic_size_t head;   // Next slot to write
+    size_t tail_cache;                              // Producer's copy of 'tail'
+
+    // -------------------------------------------------------------------------
+    // Consumer Cache Line
+    // -------------------------------------------------------------------------
+    alignas(NKIT_CACHE_LINE) atomic_size_t tail;   // Next slot to read
+    size_t head_cache;                              // Consumer's copy of 'head'
+
+    // -------------------------------------------------------------------------
+    // Read-Only Fields (Shared)
+    // -------------------------------------------------------------------------
+    alignas(NKIT_CACHE_LINE) size_t capacity;      // Number of items the ring can hold
+    size_t mask;                                    // capacity - 1
+    void** slots;                                   // Array of 'capacity' pointers
+    struct nkit_arena_s* _arena;                    // Arena holding struct + slots
+
+} nkit_spsc_t;
+
+/**
+ * @brief Create an SPSC ring pinned to a specific NUMA node.
+ * Place it on the consumer's node: the producer's stores travel once,
+ * the consumer's reads stay local.
+ * @param node_id The NUMA node where memory should physically reside.
+ * @param capacity Number of items (must be power of 2).
+ * @return Pointer to new ring, or NULL on failure.
+ */
+nkit_spsc_t* nkit_spsc_create(int node_id, size_t capacity);
+
+/**
+ * @brief Destroy the ring and release its memory.
+ */
+void nkit_spsc_free(nkit_spsc_t* ring);
+
+/**
+ * @brief Push one item (producer thread only).
+ * @return true if successful, false if full.
+ */
+static inline bool nkit_spsc_push(nkit_spsc_t* ring, void* item) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    if (head - ring->tail_cache == ring->capacity) {
+        // Looks full: refresh our view of the consumer
+        ring->tail_cache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if (head - ring->tail_cache == ring->capacity) return false;
+    }
+
+    ring->slots[head & ring->mask] = item;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Pop one item (consumer thread only).
+ * @return true if an item was popped, false if empty.
+ */
+static inline bool nkit_spsc_pop(nkit_spsc_t* ring, void** item) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    if (tail == ring->head_cache) {
+        // Looks empty: refresh our view of the producer
+        ring->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail == ring->head_cache) return false;
+    }
+
+    *item = ring->slots[tail & ring->mask];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Push up to 'n' items with a single index update (producer only).
+ * @return Number of items pushed (0 if full).
+ */
+static inline size_t nkit_spsc_push_burst(nkit_spsc_t* ring, void* const* items, size_t n) {
+    size_t head  = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t space = ring->capacity - (head - ring->tail_cache);
+
+    if (space < n) {
+        ring->tail_cache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        space = ring->capacity - (head - ring->tail_cache);
+    }
+    if (n > space) n = space;
+
+    for (size_t i = 0; i < n; i++) {
+        ring->slots[(head + i) & ring->mask] = items[i];
+    }
+    if (n) atomic_store_explicit(&ring->head, head + n, memory_order_release);
+    return n;
+}
+
+/**
+ * @brief Pop up to 'n' items with a single index update (consumer only).
+ * @return Number of items popped (0 if empty).
+ */
+static inline size_t nkit_spsc_pop_burst(nkit_spsc_t* ring, void** items, size_t n) {
+    size_t tail  = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t avail = ring->head_cache - tail;
+
+    if (avail < n) {
+        ring->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+        avail = ring->head_cache - tail;
+    }
+    if (n > avail) n = avail;
+
+    for (size_t i = 0; i < n; i++) {
+        items[i] = ring->slots[(tail + i) & ring->mask];
+    }
+    if (n) atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+    return n;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NKIT_SPSC_RING_H
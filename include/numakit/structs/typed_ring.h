@@ -0,0 +1,139 @@
+#ifndef NKIT_TYPED_RING_H
+#define NKIT_TYPED_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include <numakit/memory.h>
+#include <numakit/structs/ring_buffer.h>
+
+/**
+ * @brief Declare a lock-free MPMC ring that stores 'type' by value.
+ *
+ * nkit_ring_t cells carry a pointer, so the consumer dereferences memory
+ * the producer allocated, usually on the producer's node. A typed ring
+ * copies the message itself into the cell: with the ring created on the
+ * consumer's node, the producer pays one remote write per message and
+ * the consumer reads local memory only. Best for small fixed-size
+ * messages (a few cache lines at most), since every push/pop copies.
+ *
+ * Same algorithm and guarantees as nkit_ring_t (per-cell sequence
+ * numbers, one CAS per operation). Expands to:
+ *
+ *     typedef ... name##_t;
+ *     name##_t* name##_create(int node_id, size_t capacity);  // power of 2
+ *     void      name##_free(name##_t* ring);
+ *     bool      name##_push(name##_t* ring, const type* item); // false if full
+ *     bool      name##_pop(name##_t* ring, type* item);        // false if empty
+ *
+ * Use it once per message type, at file scope:
+ *
+ *     typedef struct { uint64_t key; double value[5]; } update_t;
+ *     NKIT_TYPED_RING(update_ring, update_t)
+ */
+#define NKIT_TYPED_RING(name, type)                                                     \
+                                                                                        \
+typedef struct {                                                                        \
+    atomic_size_t sequence;                                                             \
+    type data;                                                                          \
+} name##_cell_t;                                                                        \
+                                                                                        \
+typedef struct {                                                                        \
+    alignas(NKIT_CACHE_LINE) atomic_size_t head;                                        \
+    char pad1[NKIT_CACHE_LINE - sizeof(atomic_size_t)];                                 \
+    alignas(NKIT_CACHE_LINE) atomic_size_t tail;                                        \
+    char pad2[NKIT_CACHE_LINE - sizeof(atomic_size_t)];                                 \
+    size_t capacity;                                                                    \
+    size_t mask;                                                                        \
+    name##_cell_t* cells;                                                               \
+    struct nkit_arena_s* _arena;                                                        \
+} name##_t;                                                                             \
+                                                                                        \
+static inline name##_t* name##_create(int node_id, size_t capacity) {                  \
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0) return NULL;                  \
+                                                                                        \
+    /* Cells start on a cache line of their own */                                      \
+    size_t struct_sz = (sizeof(name##_t) + NKIT_CACHE_LINE - 1)                         \
+                     & ~(size_t)(NKIT_CACHE_LINE - 1);                                  \
+    size_t total_sz  = struct_sz + sizeof(name##_cell_t) * capacity;                    \
+                                                                                        \
+    nkit_arena_t* arena = nkit_arena_create(node_id, total_sz);                         \
+    if (!arena) return NULL;                                                            \
+    void* block = nkit_arena_alloc(arena, total_sz);                                    \
+    if (!block) {                                                                       \
+        nkit_arena_destroy(arena);                                                      \
+        return NULL;                                                                    \
+    }                                                                                   \
+                                                                                        \
+    name##_t* ring = (name##_t*)block;                                                  \
+    ring->cells    = (name##_cell_t*)((char*)block + struct_sz);                        \
+    ring->capacity = capacity;                                                          \
+    ring->mask     = capacity - 1;                                                      \
+    ring->_arena   = (struct nkit_arena_s*)arena;                                       \
+    atomic_init(&ring->head, 0);                                                        \
+    atomic_init(&ring->tail, 0);                                                        \
+    for (size_t i = 0; i < capacity; i++) {                                             \
+        atomic_init(&ring->cells[i].sequence, i);                                       \
+    }                                                                                   \
+    return ring;                                                                        \
+}                                                                                       \
+                                                                                        \
+static inline void name##_free(name##_t* ring) {                                        \
+    if (ring && ring->_arena) nkit_arena_destroy((nkit_arena_t*)ring->_arena);          \
+}                                                                                       \
+                                                                                        \
+static inline bool name##_push(name##_t* ring, const type* item) {                      \
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);              \
+    for (;;) {                                                                          \
+        name##_cell_t* cell = &ring->cells[head & ring->mask];                          \
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);       \
+        intptr_t diff = (intptr_t)seq - (intptr_t)head;                                 \
+        if (diff == 0) {                                                                \
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &head, head + 1,     \
+                    memory_order_relaxed, memory_order_relaxed)) {                      \
+                cell->data = *item;                                                     \
+                atomic_store_explicit(&cell->sequence, head + 1, memory_order_release); \
+                return true;                                                            \
+            }                                                                           \
+        } else if (diff < 0) {                                                          \
+            return false; /* Full */                                                    \
+        } else {                                                                        \
+            head = atomic_load_explicit(&ring->head, memory_order_relaxed);             \
+        }                                                                               \
+    }                                                                                   \
+}                                                                                       \
+                                                                                        \
+static inline bool name##_pop(name##_t* ring, type* item) {                             \
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);              \
+    for (;;) {                                                                          \
+        name##_cell_t* cell = &ring->cells[tail & ring->mask];                          \
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);       \
+        intptr_t diff = (intptr_t)seq - (intptr_t)(tail + 1);                           \
+        if (diff == 0) {                                                                \
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &tail, tail + 1,     \
+                    memory_order_relaxed, memory_order_relaxed)) {                      \
+                *item = cell->data;                                                     \
+                atomic_store_explicit(&cell->sequence, tail + ring->mask + 1,           \
+                                      memory_order_release);                            \
+                return true;                                                            \
+            }                                                                           \
+        } else if (diff < 0) {                                                          \
+            return false; /* Empty */                                                   \
+        } else {                                                                        \
+            tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);             \
+        }                                                                               \
+    }                                                                                   \
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NKIT_TYPED_RING_H
@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stdatomic.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdalign.h>
 
@@ -190,6 +191,100 @@ int64_t nkit_pcounter_read(nkit_pcounter_t* counter);
  */
 void nkit_pcounter_reset(nkit_pcounter_t* counter);
 
+// =============================================================================
+// Eventcount (Futex-Backed Wait / Notify)
+// =============================================================================
+
+/**
+ * @brief Eventcount: lets a consumer sleep until a lock-free structure
+ * changes, without putting a lock on the producer side.
+ *
+ * Waiter protocol (the re-check closes the race with a concurrent notify):
+ *
+ *     while (!try_consume()) {
+ *         uint32_t key = nkit_ec_prepare_wait(&ec);
+ *         if (try_consume()) { nkit_ec_cancel_wait(&ec); break; }
+ *         nkit_ec_wait(&ec, key, timeout_ms);
+ *     }
+ *
+ * nkit_ec_await() runs this loop (plus a short spin and a deadline) around
+ * a try function; consumers should use it rather than open-code it.
+ *
+ * Producers publish, then call nkit_ec_notify(). With nobody parked that
+ * is one fence and one load of 'waiters'; the futex syscall is only made
+ * when a waiter is registered.
+ */
+typedef struct {
+    _Atomic(uint32_t) seq;      // Futex word, bumped by every wake
+    _Atomic(uint32_t) waiters;  // Threads between prepare and wait/cancel
+} nkit_eventcount_t;
+
+/**
+ * @brief Initialize an eventcount (zero-filled memory is also valid).
+ */
+void nkit_ec_init(nkit_eventcount_t* ec);
+
+/**
+ * @brief Register as a waiter and return the key to pass to nkit_ec_wait().
+ * Re-check the condition after this call, before waiting.
+ */
+uint32_t nkit_ec_prepare_wait(nkit_eventcount_t* ec);
+
+/**
+ * @brief Deregister after nkit_ec_prepare_wait() when the re-check succeeded.
+ */
+void nkit_ec_cancel_wait(nkit_eventcount_t* ec);
+
+/**
+ * @brief Sleep until notified after 'key' was taken, or until timeout.
+ * Returns immediately if a notify already happened. Deregisters the waiter.
+ * @param timeout_ms Maximum time to sleep, < 0 to wait indefinitely.
+ * @return 0 if woken (possibly spuriously), -1 on timeout.
+ */
+int nkit_ec_wait(nkit_eventcount_t* ec, uint32_t key, int timeout_ms);
+
+/**
+ * @brief Block until 'try_fn' succeeds, parking on 'ec' between attempts.
+ * Polls 'try_fn' up to 'spins' times first, then follows the waiter
+ * protocol above until it succeeds or the timeout expires.
+ * @param try_fn     Non-blocking attempt; returns true once it consumed.
+ * @param arg        Passed to 'try_fn'.
+ * @param spins      Polls before the first park.
+ * @param timeout_ms Maximum total wait, < 0 to wait indefinitely.
+ * @return true if 'try_fn' succeeded, false on timeout.
+ */
+bool nkit_ec_await(nkit_eventcount_t* ec, bool (*try_fn)(void* arg), void* arg,
+                   int spins, int timeout_ms);
+
+// Internal: slow path of the notify calls (bump 'seq', futex wake)
+void _nkit_ec_wake(nkit_eventcount_t* ec, int count);
+
+/**
+ * @brief Wake one parked waiter, if any. Call after publishing.
+ * @return true if a waiter was registered (and woken), false if nobody
+ *         was about to sleep on 'ec'.
+ */
+static inline bool nkit_ec_notify(nkit_eventcount_t* ec) {
+    // Order the caller's publish before reading 'waiters' (pairs with the
+    // fence in nkit_ec_prepare_wait)
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ec->waiters, memory_order_relaxed) != 0) {
+        _nkit_ec_wake(ec, 1);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Wake every parked waiter, if any (e.g. on shutdown).
+ */
+static inline void nkit_ec_notify_all(nkit_eventcount_t* ec) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ec->waiters, memory_order_relaxed) != 0) {
+        _nkit_ec_wake(ec, INT32_MAX);
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
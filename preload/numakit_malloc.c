@@ -0,0 +1,247 @@
+/*
+ * libnumakit_malloc: LD_PRELOAD interposer that serves the C allocation
+ * API from a process-wide nkit_mempool.
+ *
+ *     LD_PRELOAD=libnumakit_malloc.so ./service
+ *
+ * Small requests come from the calling thread's node through the pool's
+ * thread caches, large ones from its per-node hugepage runs; thread exit
+ * flushes the caches (see the mempool's tcache destructor). Memory the
+ * pool cannot provide, or that was allocated before the pool existed or
+ * from inside the library itself, stays with glibc and is routed back to
+ * it by free().
+ *
+ * Environment:
+ *     NKIT_MALLOC_DISABLE=1  Pass everything through to glibc.
+ *     NKIT_MALLOC_STATS=1    Print per-node memory telemetry at exit.
+ */
+#define _GNU_SOURCE
+
+#include <numakit/numakit.h>
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NKIT_EXPORT __attribute__((visibility("default")))
+
+// glibc's own allocator, always reachable under these names
+extern void* __libc_malloc(size_t size);
+extern void  __libc_free(void* ptr);
+extern void* __libc_calloc(size_t n, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void* __libc_memalign(size_t align, size_t size);
+
+static _Atomic(nkit_mempool_t*) g_pool;   // NULL until the constructor is done
+static size_t (*g_libc_usable_size)(void*);
+
+// Set while this thread runs inside the pool: anything the library (or
+// libnuma/hwloc underneath it) allocates then goes to glibc. Initial-exec
+// TLS, so reading it never allocates.
+static __thread int t_in_pool __attribute__((tls_model("initial-exec")));
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static inline nkit_mempool_t* _shim_pool(void) {
+    if (t_in_pool) return NULL;
+    return atomic_load_explicit(&g_pool, memory_order_acquire);
+}
+
+static inline void* _shim_alloc(nkit_mempool_t* pool, size_t size, size_t align) {
+    t_in_pool = 1;
+    void* ptr = align ? nkit_mempool_alloc_aligned(pool, size, align)
+                      : nkit_mempool_alloc(pool, size);
+    t_in_pool = 0;
+    return ptr;
+}
+
+/**
+ * @brief Usable size if the pool owns 'ptr', 0 if it is glibc's.
+ */
+static inline size_t _shim_owned(const void* ptr) {
+    nkit_mempool_t* pool = atomic_load_explicit(&g_pool, memory_order_acquire);
+    return pool ? nkit_mempool_usable_size(pool, ptr) : 0;
+}
+
+static void* _shim_memalign(size_t align, size_t size) {
+    nkit_mempool_t* pool = _shim_pool();
+    if (pool) {
+        void* ptr = _shim_alloc(pool, size ? size : 1, align);
+        if (ptr) return ptr;
+    }
+    // Page-sized and larger alignments, or pool exhausted
+    return __libc_memalign(align, size);
+}
+
+static void _shim_report(void) {
+    nkit_mem_stats_t stats;
+    t_in_pool = 1;
+    if (nkit_mem_stats_snapshot(&stats) == 0) {
+        for (int n = 0; n < stats.num_nodes; n++) {
+            const nkit_node_mem_stats_t* s = &stats.nodes[n];
+            fprintf(stderr, "[numakit_malloc] node %d: mapped %zu KB (huge %zu KB), "
+                            "in use %zu KB, remote fallbacks %llu, slab exhausted %llu\n",
+                    n, (size_t)(s->bytes_mapped >> 10), (size_t)(s->bytes_huge >> 10),
+                    (size_t)(s->bytes_in_use >> 10),
+                    (unsigned long long)s->remote_fallbacks,
+                    (unsigned long long)s->slab_exhausted);
+        }
+    }
+    t_in_pool = 0;
+}
+
+// fork() with a pool lock held elsewhere must not leave the child stuck
+static void _shim_prefork(void) {
+    nkit_mempool_prefork(atomic_load_explicit(&g_pool, memory_order_acquire));
+}
+
+static void _shim_postfork_parent(void) {
+    nkit_mempool_postfork_parent(atomic_load_explicit(&g_pool, memory_order_acquire));
+}
+
+static void _shim_postfork_child(void) {
+    nkit_mempool_postfork_child(atomic_load_explicit(&g_pool, memory_order_acquire));
+}
+
+__attribute__((constructor)) static void _shim_init(void) {
+    t_in_pool = 1;
+
+    g_libc_usable_size = (size_t (*)(void*))dlsym(RTLD_NEXT, "malloc_usable_size");
+
+    nkit_mempool_t* pool = NULL;
+    const char* disable = getenv("NKIT_MALLOC_DISABLE");
+    if ((!disable || *disable == '0') && nkit_init() == 0) {
+        pool = nkit_mempool_create();
+    }
+    if (pool && getenv("NKIT_MALLOC_STATS")) {
+        atexit(_shim_report);
+    }
+    if (pool && pthread_atfork(_shim_prefork, _shim_postfork_parent,
+                               _shim_postfork_child) != 0) {
+        nkit_mempool_destroy(pool);
+        pool = NULL;
+    }
+
+    // The pool is never destroyed: atexit handlers and late destructors
+    // may still free blocks after main() returns.
+    t_in_pool = 0;
+    atomic_store_explicit(&g_pool, pool, memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+// Interposed API
+// ---------------------------------------------------------------------------
+
+NKIT_EXPORT void* malloc(size_t size) {
+    nkit_mempool_t* pool = _shim_pool();
+    if (pool) {
+        // malloc(0) must return a unique pointer
+        void* ptr = _shim_alloc(pool, size ? size : 1, 0);
+        if (ptr) return ptr;
+    }
+    return __libc_malloc(size);
+}
+
+NKIT_EXPORT void free(void* ptr) {
+    if (!ptr) return;
+    if (_shim_owned(ptr)) {
+        int nested = t_in_pool;
+        t_in_pool = 1;
+        nkit_mempool_free(atomic_load_explicit(&g_pool, memory_order_relaxed), ptr);
+        t_in_pool = nested;
+        return;
+    }
+    __libc_free(ptr);
+}
+
+NKIT_EXPORT void* calloc(size_t n, size_t size) {
+    if (size && n > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    nkit_mempool_t* pool = _shim_pool();
+    if (pool) {
+        size_t bytes = n * size;
+        void* ptr = _shim_alloc(pool, bytes ? bytes : 1, 0);
+        if (ptr) {
+            // Blocks are recycled: unlike fresh mmap pages they are not zero
+            memset(ptr, 0, bytes);
+            return ptr;
+        }
+    }
+    return __libc_calloc(n, size);
+}
+
+NKIT_EXPORT void* realloc(void* ptr, size_t size) {
+    if (!ptr) return malloc(size);
+    if (size == 0) {
+        free(ptr);
+        return NULL;
+    }
+
+    size_t old = _shim_owned(ptr);
+    if (old == 0) return __libc_realloc(ptr, size);
+
+    // Fits, and not worth moving to a smaller block
+    if (size <= old && size >= old / 2) return ptr;
+
+    void* grown = malloc(size);
+    if (!grown) return NULL;
+    memcpy(grown, ptr, size < old ? size : old);
+    free(ptr);
+    return grown;
+}
+
+NKIT_EXPORT void* reallocarray(void* ptr, size_t n, size_t size) {
+    if (size && n > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    return realloc(ptr, n * size);
+}
+
+NKIT_EXPORT int posix_memalign(void** memptr, size_t align, size_t size) {
+    if (align < sizeof(void*) || (align & (align - 1)) != 0) return EINVAL;
+
+    void* ptr = _shim_memalign(align, size);
+    if (!ptr) return ENOMEM;
+    *memptr = ptr;
+    return 0;
+}
+
+NKIT_EXPORT void* aligned_alloc(size_t align, size_t size) {
+    if (align == 0 || (align & (align - 1)) != 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+    return _shim_memalign(align, size);
+}
+
+NKIT_EXPORT void* memalign(size_t align, size_t size) {
+    return aligned_alloc(align, size);
+}
+
+NKIT_EXPORT void* valloc(size_t size) {
+    return _shim_memalign((size_t)sysconf(_SC_PAGESIZE), size);
+}
+
+NKIT_EXPORT void* pvalloc(size_t size) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return _shim_memalign(page, (size + page - 1) & ~(page - 1));
+}
+
+NKIT_EXPORT size_t malloc_usable_size(void* ptr) {
+    if (!ptr) return 0;
+    size_t owned = _shim_owned(ptr);
+    if (owned) return owned;
+    return g_libc_usable_size ? g_libc_usable_size(ptr) : 0;
+}
@@ -47,7 +47,19 @@ int nkit_init(void) {
         return -1;
     }
 
-    // 6. Initialize Mailboxes (One per Node)
+    // 6. Set Defaults
+    g_nkit_ctx.balancer_threshold_mpki = DEFAULT_MPKI; // Default: 5% miss rate is "bad"
+
+    // 7. Cache key metrics (to avoid querying hwloc repeatedly)
+    g_nkit_ctx.num_nodes = hwloc_get_nbobjs_by_type(g_nkit_ctx.topo, HWLOC_OBJ_NUMANODE);
+    g_nkit_ctx.num_pus   = hwloc_get_nbobjs_by_type(g_nkit_ctx.topo, HWLOC_OBJ_PU);
+
+    // 8. Fallback for non-NUMA systems (Unified Memory)
+    if (g_nkit_ctx.num_nodes <= 0) {
+        g_nkit_ctx.num_nodes = 1; 
+    }
+
+    // 9. Initialize Mailboxes (One per Node, now that num_nodes is known)
     g_nkit_ctx.mailboxes = calloc(g_nkit_ctx.num_nodes, sizeof(nkit_mailbox_t*));
 
     if (g_nkit_ctx.mailboxes) {
@@ -61,24 +73,13 @@ int nkit_init(void) {
             }
 
             if (g_nkit_ctx.mailboxes[i]) {
-                // Initialize Ring (already hugepage backed on Node i)
-                g_nkit_ctx.mailboxes[i]->ring = nkit_ring_create(i, 4096);
+                // Initialize Queue (segments come from a slab on Node i)
+                g_nkit_ctx.mailboxes[i]->queue = nkit_mpsc_create(i);
+                atomic_flag_clear(&g_nkit_ctx.mailboxes[i]->draining);
             }
         }
     }
 
-    // 7. Set Defaults
-    g_nkit_ctx.balancer_threshold_mpki = DEFAULT_MPKI; // Default: 5% miss rate is "bad"
-
-    // 8. Cache key metrics (to avoid querying hwloc repeatedly)
-    g_nkit_ctx.num_nodes = hwloc_get_nbobjs_by_type(g_nkit_ctx.topo, HWLOC_OBJ_NUMANODE);
-    g_nkit_ctx.num_pus   = hwloc_get_nbobjs_by_type(g_nkit_ctx.topo, HWLOC_OBJ_PU);
-
-    // 9. Fallback for non-NUMA systems (Unified Memory)
-    if (g_nkit_ctx.num_nodes <= 0) {
-        g_nkit_ctx.num_nodes = 1; 
-    }
-
     return 0;
 }
 
@@ -87,7 +88,7 @@ void nkit_teardown(void) {
     if (g_nkit_ctx.mailboxes) {
         for (int i = 0; i < g_nkit_ctx.num_nodes; i++) {
             if (g_nkit_ctx.mailboxes[i]) {
-                nkit_ring_free(g_nkit_ctx.mailboxes[i]->ring);
+                nkit_mpsc_destroy(g_nkit_ctx.mailboxes[i]->queue);
 
                 if (g_nkit_ctx.numa_supported) {
                     numa_free(g_nkit_ctx.mailboxes[i], sizeof(nkit_mailbox_t));
@@ -97,6 +98,7 @@ void nkit_teardown(void) {
             }
         }
         free(g_nkit_ctx.mailboxes);
+        g_nkit_ctx.mailboxes = NULL;
     }
 
     bool expected = true;
@@ -2,12 +2,17 @@
 #define _NKIT_INTERNAL_H
 
 #include "numakit/structs/ring_buffer.h"
+#include "numakit/structs/mpsc_queue.h"
+#include "numakit/memory.h"
+#include "numakit/sync.h"
 #include <hwloc.h>
 #include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 typedef struct nkit_mailbox_t {
-    nkit_ring_t* ring;      // The storage (Hugepage backed)
+    nkit_mpsc_t* queue;     // Unbounded, segments on the mailbox's node
+    atomic_flag draining;   // Held by the one thread consuming the queue
     char pad[64];           // Padding to ensure cache line alignment
 } nkit_mailbox_t;
 
@@ -39,10 +44,82 @@ typedef struct {
 // Defined in init.c
 extern nkit_context_t g_nkit_ctx;
 
-// Internal Helper: Detects default hugepage size from /proc/meminfo
+// Internal Helper: Default hugepage size from /proc/meminfo (read once)
 size_t _nkit_get_hugepage_size(void);
 
 // Internal Helper: Get the hwloc object for a specific node ID
 hwloc_obj_t _nkit_get_hwloc_node(int node_id);
 
+/**
+ * @brief Owner record of a range of pages in the page map.
+ *
+ * Allocators embed one of these in their own metadata (slab extents,
+ * mempool large spans) and register it for the pages they hand out, so
+ * a bare pointer resolves to its owner without a per-object header.
+ */
+typedef struct {
+    void*    owner;  // Owning allocator object (e.g. nkit_slab_t*)
+    uint32_t tag;    // Owner-defined (the mempool stores the size class)
+    int32_t  node;   // NUMA node the pages are bound to
+} _nkit_page_owner_t;
+
+// Internal Helper: Register 'owner' for every 4KB page overlapping
+// [addr, addr + len), or clear them when owner is NULL. 0 on success.
+int _nkit_pagemap_set(const void* addr, size_t len, const _nkit_page_owner_t* owner);
+
+// Internal Helper: Owner record of the page containing 'addr', or NULL
+const _nkit_page_owner_t* _nkit_pagemap_get(const void* addr);
+
+// Internal Helper: Slab with explicit slot alignment whose extents are
+// registered with 'tag' (see _nkit_page_owner_t)
+nkit_slab_t* _nkit_slab_create_tagged(int node_id, size_t obj_size, size_t align,
+                                      size_t extent_capacity, size_t max_extents,
+                                      uint32_t tag);
+
+// Internal Helper: Fork support for every live slab. prefork takes the
+// registry lock and each grow lock; the child re-initializes them.
+void _nkit_slab_prefork(void);
+void _nkit_slab_postfork_parent(void);
+void _nkit_slab_postfork_child(void);
+
+// Internal Helper: Query the node of 'count' pages starting at page-aligned
+// 'base' with batched move_pages calls, one status per page (node or -errno).
+// Without NUMA support, mincore gives node 0 or -ENOENT / -EFAULT instead.
+int _nkit_query_pages(uintptr_t base, size_t count, long page_size, int* status);
+
+// Internal Helper: Counter with an explicit slot count (independent of init)
+nkit_pcounter_t* _nkit_pcounter_create_n(int num_slots);
+
+// Internal Helper: Add to / read one slot directly. Used when the slot
+// is the node an event is *about*, not the node of the calling thread.
+void _nkit_pcounter_add_slot(nkit_pcounter_t* counter, int slot, int64_t value);
+int64_t _nkit_pcounter_read_slot(nkit_pcounter_t* counter, int slot);
+
+/**
+ * @brief Library-wide per-node memory counters (see nkit_mem_stats_t).
+ */
+typedef enum {
+    _NKIT_STAT_MAPPED_HUGE,      // Arena chunks on hugetlb/THP pages
+    _NKIT_STAT_MAPPED_4K,        // Arena chunks on base pages
+    _NKIT_STAT_IN_USE,           // Mempool large blocks out (slabs: see below)
+    _NKIT_STAT_REMOTE_FALLBACK,  // Mempool allocs served by another node
+    _NKIT_STAT_SLAB_EXHAUSTED,   // Slab allocs that found no slot and could not grow
+    _NKIT_STAT_COUNT
+} _nkit_stat_t;
+
+// Internal Helper: Account 'delta' to a per-node counter (one relaxed add)
+void _nkit_stat_add(_nkit_stat_t stat, int node, int64_t delta);
+
+// Internal Helper: Add the bytes of slab objects handed out, per node,
+// by walking the live-slab registry (keeps slab alloc/free untouched)
+void _nkit_slab_in_use(uint64_t* per_node, int num_nodes);
+
+// Internal Helper: Node an arena / slab was created for
+int _nkit_arena_node(const nkit_arena_t* arena);
+int _nkit_slab_node(const nkit_slab_t* slab);
+
+// Internal Helper: 'node' itself, or the nearest node (by distance) that
+// the running pressure monitor does not report as low on memory
+int _nkit_pressure_spill_node(int node);
+
 #endif // _NKIT_INTERNAL_H
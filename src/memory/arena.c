@@ -2,109 +2,849 @@
 
 #include <numakit/memory.h>
 #include <numakit/numakit.h>
+#include "../internal.h"
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <numa.h>
 #include <numaif.h>
+#include <pthread.h>
+#include <time.h>
+#include <stdalign.h>
+#include <stdatomic.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-// 2MB Hugepage size (standard on x86)
+// 2MB Hugepage size (standard on x86): chunk granularity and THP alignment
 #define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#define GIGA_PAGE_SIZE (1024UL * 1024 * 1024)
+
+// Explicit hugetlb page sizes (older libc headers lack them)
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+// Kernel-side populate honouring the VMA's NUMA policy (Linux 5.14+)
+#ifndef MADV_POPULATE_READ
+#define MADV_POPULATE_READ  22
+#endif
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+#ifndef HUGETLBFS_MAGIC
+#define HUGETLBFS_MAGIC 0x958458f6
+#endif
+
+#ifndef MPOL_PREFERRED_MANY
+#define MPOL_PREFERRED_MANY 5
+#endif
+
+// Upper bound on first-touch workers for one chunk
+#define PREFAULT_MAX_THREADS 256
+
+// Per-thread sub-blocks of concurrent arenas: a thread's first block is
+// small, each refill doubles it up to the max, so idle threads waste
+// little and busy threads rarely touch the shared offset.
+#define TLAB_MIN_SIZE (64 * 1024)
+#define TLAB_MAX_SIZE (2 * 1024 * 1024)
+#define TLAB_SLOTS    4  // Concurrent arenas a thread can cache at once
+
+// Dirty bytes a rewind leaves above its mark for the next scratch burst;
+// anything deeper is handed back to the OS.
+#define SCRATCH_KEEP (2 * 1024 * 1024)
+
+/**
+ * @brief One contiguous, node-bound mapping owned by an arena.
+ *
+ * Fixed-size arenas own exactly one chunk. Growable arenas chain extra
+ * chunks on demand and keep them across nkit_arena_reset() so the next
+ * cycle does not pay mmap/mbind again.
+ */
+typedef struct nkit_arena_chunk_s {
+    void*  base;                      // Start of the mapping
+    size_t size;                      // Mapping size (multiple of page_bytes, >= 2MB aligned)
+    int    use_huge;                  // 1 if backed by hugetlbfs pages
+    nkit_page_size_t backing;         // Page size actually obtained
+    size_t page_bytes;                // Granularity for madvise/munmap
+    int    node;                      // Node the chunk was bound to (may differ when spilled)
+    size_t file_bytes;                // Leading bytes mapped from a file (0 = anonymous)
+    struct nkit_arena_chunk_s* next;  // Next chunk in the chain (or NULL)
+} nkit_arena_chunk_t;
 
 struct nkit_arena_s {
-    void* base;        // Pointer to the start of memory
-    size_t size;        // Total size
-    size_t used;        // Bytes allocated
+    // Bump state of the current chunk (the only fields touched on the fast path)
+    void*  base;        // Pointer to the start of the current chunk
+    size_t size;        // Size of the current chunk
+    size_t used;        // Bytes allocated in the current chunk
     int    node_id;     // NUMA node this arena belongs to
     int    use_huge;    // 1 if backed by hugepages, 0 if standard pages
+    nkit_arena_attr_t attr;    // Creation attributes, reused for every chunk
+    nkit_page_size_t  backing; // Weakest backing among all chunks
+    uint64_t          prefault_ns; // Time spent pre-faulting all chunks
+
+    // Chunk chain (slow path only)
+    nkit_arena_chunk_t  first;        // Initial mapping, embedded
+    nkit_arena_chunk_t* current;      // Chunk mirrored by base/size/used
+    size_t chunk_size;                // Growth granularity (0 = fixed-size arena)
+    size_t retired_used;              // Bytes consumed in chunks before 'current'
+    size_t total_size;                // Sum of all chunk sizes
+    size_t high_water;                // Deepest offset possibly dirtied since the last release
+
+    // File-backed arenas (nkit_arena_create_file)
+    size_t file_len;                  // Bytes of file contents at the start of 'first'
+    size_t floor;                     // Offset of 'first' that reset/rewind never go below
+
+    // Concurrent arenas (single chunk, shared by many threads)
+    int      concurrent;              // 1 if created by nkit_arena_create_concurrent
+    uint64_t id;                      // Unique per arena ever created (TLAB key)
+    atomic_uint_fast64_t epoch;       // Bumped by reset: invalidates every TLAB
+    alignas(64) atomic_size_t reserved;  // Shared offset, advanced by fetch-add
 };
 
-nkit_arena_t* nkit_arena_create(int node_id, size_t size) {
-    if (size == 0) return NULL;
+/**
+ * @brief A thread's private sub-block of one concurrent arena.
+ *
+ * Keyed by arena id (never reused, unlike addresses) and epoch, so
+ * slots left over from destroyed or reset arenas simply never match.
+ */
+typedef struct {
+    uint64_t id;          // Arena id (0 = empty slot)
+    uint64_t epoch;       // Arena epoch the block was reserved in
+    char*    cur;         // Next free byte
+    char*    end;         // End of the sub-block
+    size_t   next_block;  // Size of the next reservation
+} nkit_arena_tlab_t;
 
-    // 1. Allocate the struct (small, just malloc is fine)
-    nkit_arena_t* arena = malloc(sizeof(nkit_arena_t));
-    if (!arena) return NULL;
+static _Thread_local nkit_arena_tlab_t t_tlabs[TLAB_SLOTS];
+static _Thread_local unsigned          t_tlab_victim;
+static atomic_uint_fast64_t            g_arena_ids;
 
-    // 2. Align size up to 2MB to be safe for Hugepages
-    size_t aligned_size = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Try one hugetlbfs mapping. 'size_flag' is MAP_HUGE_* or 0 for
+ *        the system default hugepage size.
+ */
+static void* _nkit_map_hugetlb(size_t size, int size_flag) {
+    void* base = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | size_flag, -1, 0);
+    return base == MAP_FAILED ? NULL : base;
+}
+
+/**
+ * @brief Map standard pages at a 2MB-aligned address and ask for THP.
+ *
+ * Over-maps by 2MB and trims both ends so whole hugepages fit.
+ * @param thp In: request THP. Out: 1 if madvise(MADV_HUGEPAGE) was accepted.
+ */
+static void* _nkit_map_standard(size_t size, int* thp) {
+    size_t span = *thp ? size + HUGE_PAGE_SIZE : size;
+    char* raw = mmap(NULL, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+    if (!*thp) return raw;
+
+    char* base = (char*)(((uintptr_t)raw + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+    if (base > raw) munmap(raw, (size_t)(base - raw));
+    size_t tail = (size_t)((raw + span) - (base + size));
+    if (tail) munmap(base + size, tail);
+
+    *thp = madvise(base, size, MADV_HUGEPAGE) == 0;
+    return base;
+}
+
+/**
+ * @brief Nodes a policy applies to: the attribute mask, or its default.
+ */
+static unsigned long _nkit_policy_nodes(int node_id, const nkit_arena_attr_t* attr) {
+    if (attr->nodemask) return (unsigned long)attr->nodemask;
+    if (attr->policy == NKIT_POLICY_BIND) return 1UL << node_id;
+
+    // Every node of the machine
+    int max = numa_available() < 0 ? 0 : numa_max_node();
+    if (max >= NKIT_ARENA_MAX_NODES) max = NKIT_ARENA_MAX_NODES - 1;
+    return max == NKIT_ARENA_MAX_NODES - 1 ? ~0UL : (1UL << (max + 1)) - 1;
+}
+
+/**
+ * @brief Apply the arena's placement policy to a fresh mapping.
+ *
+ * The kernel's MPOL_WEIGHTED_INTERLEAVE only knows system-wide weights,
+ * so per-arena weights are applied here: the mapping is cut into
+ * stripes and each run of weights[n] stripes is bound to node n.
+ *
+ * @return 0 on success, -1 if the policy cannot be honoured at all.
+ */
+static int _nkit_arena_place(char* base, size_t size, int node_id,
+                             const nkit_arena_attr_t* attr, size_t page_bytes) {
+    unsigned long nodemask = _nkit_policy_nodes(node_id, attr);
+    unsigned long maxnode = sizeof(nodemask) * 8;
+
+    switch (attr->policy) {
+    case NKIT_POLICY_INTERLEAVE:
+        return mbind(base, size, MPOL_INTERLEAVE, &nodemask, maxnode, MPOL_MF_MOVE) == 0 ? 0 : -1;
+
+    case NKIT_POLICY_PREFERRED_MANY:
+        if (mbind(base, size, MPOL_PREFERRED_MANY, &nodemask, maxnode, MPOL_MF_MOVE) == 0) {
+            return 0;
+        }
+        // Pre-5.15 kernel: prefer the lowest node of the set
+        nodemask &= -nodemask;
+        return mbind(base, size, MPOL_PREFERRED, &nodemask, maxnode, MPOL_MF_MOVE) == 0 ? 0 : -1;
+
+    case NKIT_POLICY_WEIGHTED_INTERLEAVE: {
+        size_t stripe = page_bytes > HUGE_PAGE_SIZE ? page_bytes : HUGE_PAGE_SIZE;
+        size_t off = 0;
+        while (off < size) {
+            for (int n = 0; n < NKIT_ARENA_MAX_NODES && off < size; n++) {
+                if (!(nodemask & (1UL << n))) continue;
+
+                size_t run = (size_t)(attr->weights[n] ? attr->weights[n] : 1) * stripe;
+                if (run > size - off) run = size - off;
+
+                unsigned long node = 1UL << n;
+                if (mbind(base + off, run, MPOL_BIND, &node, maxnode, MPOL_MF_MOVE) != 0) {
+                    return -1;
+                }
+                off += run;
+            }
+        }
+        return 0;
+    }
 
-    arena->size = aligned_size;
-    arena->used = 0;
-    arena->node_id = node_id;
-    arena->use_huge = 1; // Optimistic default
-
-    int default_prot_flags = PROT_READ | PROT_WRITE;
-    int default_map_flags = MAP_PRIVATE | MAP_ANONYMOUS;
-
-    // 3. PLAN A: Try to allocate Hugepages
-    // MAP_HUGETLB: Allocate 2MB pages
-    // MAP_ANONYMOUS: Not backed by a file
-    // MAP_PRIVATE: Copy-on-write (standard for memory)
-    arena->base = mmap(NULL, aligned_size, 
-                       default_prot_flags, 
-                       default_map_flags | MAP_HUGETLB, 
-                       -1, 0);
-
-    // 4. PLAN B: Fallback to Standard Pages (4KB)
-    if (arena->base == MAP_FAILED) {
-        arena->use_huge = 0; // Mark as standard pages
-
-        // Try again without MAP_HUGETLB
-        arena->base = mmap(NULL, aligned_size, 
-                           default_prot_flags, 
-                           default_map_flags, 
-                           -1, 0);
-
-        if (arena->base == MAP_FAILED) {
+    default: {
+        // MPOL_BIND: Strict policy. Only allocate on these nodes.
+        // If we are on UMA (Node 0 only) and request Node 1, this might fail.
+        // We handle that gracefully.
+        long ret = mbind(base, size, MPOL_BIND, &nodemask, maxnode, MPOL_MF_MOVE);
+
+        if (ret < 0) {
+            // If strict binding fails (e.g. Node 1 doesn't exist on this machine),
+            // we try MPOL_PREFERRED (soft preference).
+            nodemask &= -nodemask;
+            mbind(base, size, MPOL_PREFERRED, &nodemask, maxnode, MPOL_MF_MOVE);
+        }
+        return 0;
+    }
+    }
+}
+
+/**
+ * @brief Map a region with the requested page size and bind it to a NUMA node.
+ *
+ * Unless the attributes are strict, each step falls back to the next
+ * smaller backing: 1GB -> 2MB hugetlbfs -> THP -> 4KB. The default mode
+ * keeps the historical behaviour (default hugetlbfs size, then 4KB).
+ *
+ * @param size In: bytes wanted (2MB multiple). Out: bytes mapped.
+ * @param chunk Receives use_huge / backing / page_bytes.
+ * @return Base address, or NULL on failure.
+ */
+static void* _nkit_arena_map(int node_id, size_t* size, const nkit_arena_attr_t* attr,
+                             nkit_arena_chunk_t* chunk) {
+    size_t sys_page = (size_t)sysconf(_SC_PAGESIZE);
+    nkit_page_size_t want = attr->page_size;
+    void* base = NULL;
+
+    chunk->use_huge = 1; // Optimistic default
+    chunk->node = node_id;
+    chunk->file_bytes = 0;
+
+    // 1. PLAN A: hugetlbfs pages of the requested size
+    if (want == NKIT_PAGE_1G) {
+        size_t giga = (*size + GIGA_PAGE_SIZE - 1) & ~(GIGA_PAGE_SIZE - 1);
+        base = _nkit_map_hugetlb(giga, MAP_HUGE_1GB);
+        if (base) {
+            *size = giga;
+            chunk->backing = NKIT_PAGE_1G;
+            chunk->page_bytes = GIGA_PAGE_SIZE;
+        } else if (attr->strict) {
+            return NULL;
+        } else {
+            want = NKIT_PAGE_2M;
+        }
+    }
+    if (!base && want == NKIT_PAGE_2M) {
+        base = _nkit_map_hugetlb(*size, MAP_HUGE_2MB);
+        if (base) {
+            chunk->backing = NKIT_PAGE_2M;
+            chunk->page_bytes = HUGE_PAGE_SIZE;
+        } else if (attr->strict) {
+            return NULL;
+        } else {
+            want = NKIT_PAGE_THP;
+        }
+    }
+    if (!base && want == NKIT_PAGE_DEFAULT) {
+        // Default hugetlbfs size of this system (2MB or 1GB), if any
+        size_t hp = _nkit_get_hugepage_size();
+        if (hp != 0 && *size % hp == 0) {
+            base = _nkit_map_hugetlb(*size, 0);
+            if (base) {
+                chunk->backing = hp >= GIGA_PAGE_SIZE ? NKIT_PAGE_1G : NKIT_PAGE_2M;
+                chunk->page_bytes = hp;
+            }
+        }
+        if (!base) want = NKIT_PAGE_4K;
+    }
+
+    // 2. PLAN B: standard pages, optionally promoted by THP
+    if (!base) {
+        chunk->use_huge = 0;
+        int thp = (want == NKIT_PAGE_THP);
+        base = _nkit_map_standard(*size, &thp);
+        if (!base) {
             // Total failure (OOM?)
-            free(arena);
             return NULL;
         }
+        if (want == NKIT_PAGE_THP && !thp && attr->strict) {
+            munmap(base, *size);
+            return NULL;
+        }
+        chunk->backing = thp ? NKIT_PAGE_THP : NKIT_PAGE_4K;
+        chunk->page_bytes = sys_page;
+    }
+
+    // 3. Apply the NUMA placement policy
+    if (_nkit_arena_place(base, *size, node_id, attr, chunk->page_bytes) != 0) {
+        munmap(base, *size);
+        return NULL;
+    }
+
+    return base;
+}
+
+// ---------------------------------------------------------------------------
+// Pre-faulting
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    char*  begin;
+    char*  end;
+    size_t stride;   // One touch per page
+    int    node_id;
+    const nkit_arena_attr_t* file;  // Page-cache slice: placement to read it in under (else NULL)
+} nkit_prefault_job_t;
+
+static inline uint64_t _nkit_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Write one byte per page (the mapping is fresh, so zero is a no-op).
+ */
+static void _nkit_touch(char* begin, char* end, size_t stride) {
+    for (volatile char* p = begin; (char*)p < end; p += stride) {
+        *p = 0;
+    }
+}
+
+/**
+ * @brief Read one byte per page: maps file pages without dirtying them.
+ */
+static void _nkit_touch_read(const char* begin, const char* end, size_t stride) {
+    for (const volatile char* p = begin; (const char*)p < end; p += stride) {
+        (void)*p;
+    }
+}
+
+/**
+ * @brief Give the calling thread the arena's placement as its own policy.
+ *
+ * Page-cache pages are allocated under the faulting task's policy rather
+ * than the mapping's, so file readers must carry it themselves.
+ */
+static void _nkit_task_policy(int node_id, const nkit_arena_attr_t* attr) {
+    unsigned long nodemask = _nkit_policy_nodes(node_id, attr);
+    unsigned long maxnode = sizeof(nodemask) * 8;
+
+    switch (attr->policy) {
+    case NKIT_POLICY_INTERLEAVE:
+    case NKIT_POLICY_WEIGHTED_INTERLEAVE: // Per-arena weights are not expressible here
+        set_mempolicy(MPOL_INTERLEAVE, &nodemask, maxnode);
+        break;
+    case NKIT_POLICY_PREFERRED_MANY:
+        if (set_mempolicy(MPOL_PREFERRED_MANY, &nodemask, maxnode) != 0) {
+            nodemask &= -nodemask;
+            set_mempolicy(MPOL_PREFERRED, &nodemask, maxnode);
+        }
+        break;
+    default:
+        set_mempolicy(MPOL_BIND, &nodemask, maxnode);
+        break;
+    }
+}
+
+static void* _nkit_prefault_worker(void* arg) {
+    nkit_prefault_job_t* job = (nkit_prefault_job_t*)arg;
+
+    // Touch the pages from the node that owns them (best effort)
+    nkit_pin_thread_to_node(job->node_id);
+    if (job->file) {
+        _nkit_task_policy(job->node_id, job->file);
+        madvise(job->begin, (size_t)(job->end - job->begin), MADV_WILLNEED);
+        _nkit_touch_read(job->begin, job->end, job->stride);
+    } else {
+        _nkit_touch(job->begin, job->end, job->stride);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Fault in [base, end) of a freshly mapped (and already bound) chunk.
+ *
+ * POPULATE lets the kernel do it in one call; PARALLEL splits the range
+ * into page-aligned slices touched by threads running on the target
+ * node, which zero the memory with local bandwidth. Either mode falls
+ * back to touching from the calling thread. File ranges are read ahead
+ * and read instead of written, so their contents are left intact.
+ */
+static void _nkit_prefault_range(int node_id, const nkit_arena_attr_t* attr, char* base,
+                                 char* end, size_t stride, int file) {
+    if (base >= end) return;
+
+    if (attr->prefault == NKIT_PREFAULT_POPULATE) {
+        if (madvise(base, (size_t)(end - base), file ? MADV_POPULATE_READ : MADV_POPULATE_WRITE) != 0) {
+            // Pre-5.14 kernel
+            if (file) _nkit_touch_read(base, end, stride);
+            else      _nkit_touch(base, end, stride);
+        }
+        return;
+    }
+
+    // PARALLEL: one slice per worker, at least one page each
+    size_t pages = (size_t)(end - base) / stride;
+    int n = attr->prefault_threads;
+    if (n <= 0) {
+        n = nkit_topo_cpus_on_node(node_id);
+        if (n <= 0) n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (n > PREFAULT_MAX_THREADS) n = PREFAULT_MAX_THREADS;
+    if ((size_t)n > pages) n = (int)pages;
+    if (n <= 0) n = 1;
+
+    nkit_prefault_job_t jobs[PREFAULT_MAX_THREADS];
+    pthread_t threads[PREFAULT_MAX_THREADS];
+    size_t per = pages / (size_t)n;
+    size_t extra = pages % (size_t)n;
+
+    char* cursor = base;
+    int started = 0;
+    for (int i = 0; i < n; i++) {
+        size_t slice = (per + ((size_t)i < extra ? 1 : 0)) * stride;
+        jobs[i] = (nkit_prefault_job_t){ cursor, cursor + slice, stride, node_id,
+                                         file ? attr : NULL };
+        cursor += slice;
+
+        if (pthread_create(&threads[i], NULL, _nkit_prefault_worker, &jobs[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+
+    // Slices whose worker could not be started are touched here
+    for (int i = started; i < n; i++) {
+        if (file) _nkit_touch_read(jobs[i].begin, jobs[i].end, stride);
+        else      _nkit_touch(jobs[i].begin, jobs[i].end, stride);
     }
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+/**
+ * @brief Fault in a chunk: its file-backed head (if any), then the anonymous rest.
+ */
+static void _nkit_chunk_prefault(int node_id, const nkit_arena_attr_t* attr,
+                                 nkit_arena_chunk_t* chunk) {
+    char* base = chunk->base;
+    char* file_end = base + chunk->file_bytes;
+
+    // The anonymous tail behind a file (even a hugetlbfs one) uses base pages
+    size_t tail_stride = chunk->file_bytes ? (size_t)sysconf(_SC_PAGESIZE) : chunk->page_bytes;
 
-    // 5. Apply NUMA Policy (mbind)
-    // Even if we are using standard pages, we still want them on the correct node!
-    // We create a bitmask for the specific node_id.
-    unsigned long nodemask = (1UL << node_id);
+    _nkit_prefault_range(node_id, attr, base, file_end, chunk->page_bytes, 1);
+    _nkit_prefault_range(node_id, attr, file_end, base + chunk->size, tail_stride, 0);
+}
+
+/**
+ * @brief Apply the arena's prefault mode to a new chunk and account the time.
+ */
+static void _nkit_arena_prefault(nkit_arena_t* arena, nkit_arena_chunk_t* chunk) {
+    if (arena->attr.prefault == NKIT_PREFAULT_NONE) return;
 
-    // MPOL_BIND: Strict policy. Only allocate on this node.
-    // If we are on UMA (Node 0 only) and request Node 1, this might fail.
-    // We handle that gracefully.
-    long ret = mbind(arena->base, aligned_size, MPOL_BIND, &nodemask, sizeof(nodemask) * 8, MPOL_MF_MOVE);
+    uint64_t start = _nkit_now_ns();
+    _nkit_chunk_prefault(chunk->node, &arena->attr, chunk);
+    arena->prefault_ns += _nkit_now_ns() - start;
+}
+
+/**
+ * @brief Report a chunk being mapped (+1) or unmapped (-1) to the node telemetry.
+ */
+static inline void _nkit_chunk_account(const nkit_arena_chunk_t* chunk, int sign) {
+    _nkit_stat_add(chunk->backing >= NKIT_PAGE_THP ? _NKIT_STAT_MAPPED_HUGE : _NKIT_STAT_MAPPED_4K,
+                   chunk->node, sign * (int64_t)chunk->size);
+}
+
+/**
+ * @brief Make 'chunk' the current bump target.
+ */
+static inline void _nkit_arena_enter(nkit_arena_t* arena, nkit_arena_chunk_t* chunk) {
+    arena->current = chunk;
+    arena->base    = chunk->base;
+    arena->size    = chunk->size;
+    arena->used    = 0;
+}
+
+/**
+ * @brief Offset of the first 'align'-aligned byte at or after offset 'used' of 'base'.
+ */
+static inline size_t _nkit_align_offset(const void* base, size_t used, size_t align) {
+    uintptr_t p = ((uintptr_t)base + used + align - 1) & ~(uintptr_t)(align - 1);
+    return (size_t)(p - (uintptr_t)base);
+}
 
-    if (ret < 0) {
-        // If strict binding fails (e.g. Node 1 doesn't exist on this machine),
-        // we try MPOL_PREFERRED (soft preference).
-        mbind(arena->base, aligned_size, MPOL_PREFERRED, &nodemask, sizeof(nodemask) * 8, MPOL_MF_MOVE);
+/**
+ * @brief Slow path of nkit_arena_alloc: move to (or map) the next chunk.
+ *
+ * Retained chunks after 'current' are reused first; a new chunk is only
+ * mapped when none of them can hold the request.
+ */
+static void* _nkit_arena_grow(nkit_arena_t* arena, size_t size, size_t align) {
+    if (arena->chunk_size == 0) {
+        return NULL; // Fixed-size arena: out of memory
     }
 
+    // The new chunk needs room for the alignment slack and the 2MB
+    // round-up; refuse sizes where either would wrap
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t slack = align > page ? align : 0;
+    if (size > SIZE_MAX - slack - HUGE_PAGE_SIZE) {
+        return NULL;
+    }
+
+    arena->retired_used += arena->used;
+
+    // 1. Reuse a retained chunk that is large enough
+    nkit_arena_chunk_t* tail = arena->current;
+    for (nkit_arena_chunk_t* c = arena->current->next; c; c = c->next) {
+        size_t off = _nkit_align_offset(c->base, 0, align);
+        if (off <= c->size && c->size - off >= size) {
+            _nkit_arena_enter(arena, c);
+            arena->used = off + size;
+            return (char*)c->base + off;
+        }
+        tail = c;
+    }
+
+    // 2. Map a new chunk (at least one growth step, bigger for oversized
+    //    requests). Chunks are page aligned; stricter alignments need slack.
+    size_t need = size + slack;
+    size_t want = need > arena->chunk_size ? need : arena->chunk_size;
+    want = (want + HUGE_PAGE_SIZE - 1) & ~(size_t)(HUGE_PAGE_SIZE - 1);
+
+    nkit_arena_chunk_t* chunk = malloc(sizeof(nkit_arena_chunk_t));
+    if (!chunk) {
+        arena->retired_used -= arena->used;
+        return NULL;
+    }
+
+    // A bound arena whose node is under memory pressure may spill the
+    // chunk to the nearest node that is not (attr.spill)
+    int node = arena->node_id;
+    if (arena->attr.spill && arena->attr.policy == NKIT_POLICY_BIND && !arena->attr.nodemask) {
+        node = _nkit_pressure_spill_node(node);
+    }
+
+    chunk->base = _nkit_arena_map(node, &want, &arena->attr, chunk);
+    if (!chunk->base) {
+        free(chunk);
+        arena->retired_used -= arena->used;
+        return NULL;
+    }
+    chunk->size = want;
+    chunk->next = NULL;
+    if (chunk->backing < arena->backing) {
+        arena->backing = chunk->backing;
+    }
+    _nkit_arena_prefault(arena, chunk);
+    _nkit_chunk_account(chunk, 1);
+
+    tail->next = chunk;
+    arena->total_size += want;
+
+    _nkit_arena_enter(arena, chunk);
+    size_t off = _nkit_align_offset(chunk->base, 0, align);
+    arena->used = off + size;
+    return (char*)chunk->base + off;
+}
+
+// ---------------------------------------------------------------------------
+// Concurrent Arenas
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Reserve 'size' bytes of the shared region with one fetch-add.
+ * @return Start of the reservation, or NULL if it does not fit.
+ */
+static void* _nkit_arena_reserve(nkit_arena_t* arena, size_t size) {
+    // Never let a hopeless request push the shared offset around
+    if (size > arena->size) return NULL;
+
+    size_t off = atomic_fetch_add_explicit(&arena->reserved, size, memory_order_relaxed);
+    if (off + size <= arena->size) {
+        return (char*)arena->base + off;
+    }
+
+    // Overshot the end: roll back if nobody reserved after us, so a
+    // smaller request can still use the tail.
+    size_t expected = off + size;
+    atomic_compare_exchange_strong_explicit(&arena->reserved, &expected, off,
+                                            memory_order_relaxed, memory_order_relaxed);
+    return NULL;
+}
+
+/**
+ * @brief Slow path: reserve a new sub-block (or serve a big request directly).
+ */
+static void* _nkit_tlab_refill(nkit_arena_t* arena, nkit_arena_tlab_t* t,
+                               size_t size, size_t align) {
+    // Reservations stay multiples of 64 bytes, so every block starts
+    // 64-byte aligned and only stricter alignments need slack.
+    size_t slack = (align > 64 ? align - 64 : 0) + 63;
+    if (size > SIZE_MAX - slack) return NULL;
+    size_t exact = (size + slack) & ~(size_t)63;
+
+    // Big requests would waste most of a sub-block: reserve them exactly
+    if (exact > TLAB_MIN_SIZE) {
+        char* p = _nkit_arena_reserve(arena, exact);
+        return p ? p + _nkit_align_offset(p, 0, align) : NULL;
+    }
+
+    char* block = _nkit_arena_reserve(arena, t->next_block);
+    if (!block) {
+        // Arena nearly full: fall back to the exact size
+        char* p = _nkit_arena_reserve(arena, exact);
+        return p ? p + _nkit_align_offset(p, 0, align) : NULL;
+    }
+
+    char* p = block + _nkit_align_offset(block, 0, align);
+    t->cur = p + size;
+    t->end = block + t->next_block;
+    if (t->next_block < TLAB_MAX_SIZE) {
+        t->next_block *= 2;
+    }
+    return p;
+}
+
+static void* _nkit_arena_alloc_concurrent(nkit_arena_t* arena, size_t size, size_t align) {
+    uint64_t epoch = atomic_load_explicit(&arena->epoch, memory_order_acquire);
+
+    nkit_arena_tlab_t* t = NULL;
+    for (int i = 0; i < TLAB_SLOTS; i++) {
+        if (t_tlabs[i].id == arena->id) {
+            t = &t_tlabs[i];
+            break;
+        }
+    }
+
+    if (__builtin_expect(t != NULL && t->epoch == epoch, 1)) {
+        // Fast path: private bump, no atomics
+        char* ptr = t->cur + _nkit_align_offset(t->cur, 0, align);
+        if (ptr <= t->end && (size_t)(t->end - ptr) >= size) {
+            t->cur = ptr + size;
+            return ptr;
+        }
+        return _nkit_tlab_refill(arena, t, size, align);
+    }
+
+    // First use by this thread (or since the last reset): claim a slot
+    if (!t) {
+        t = &t_tlabs[t_tlab_victim++ % TLAB_SLOTS];
+        t->id = arena->id;
+    }
+    t->epoch      = epoch;
+    t->cur        = NULL;
+    t->end        = NULL;
+    t->next_block = TLAB_MIN_SIZE;
+    return _nkit_tlab_refill(arena, t, size, align);
+}
+
+/**
+ * @brief Bytes consumed in the current chunk (reserved bytes for concurrent arenas).
+ */
+static inline size_t _nkit_arena_watermark(nkit_arena_t* arena) {
+    if (!arena->concurrent) return arena->used;
+    size_t reserved = atomic_load_explicit(&arena->reserved, memory_order_relaxed);
+    return reserved < arena->size ? reserved : arena->size;
+}
+
+/**
+ * @brief Initialize a new arena around its already mapped first chunk.
+ */
+static void _nkit_arena_init(nkit_arena_t* arena, int node_id, const nkit_arena_attr_t* attr) {
+    arena->node_id      = node_id;
+    arena->use_huge     = arena->first.use_huge;
+    arena->attr         = *attr;
+    arena->backing      = arena->first.backing;
+    arena->prefault_ns  = 0;
+    arena->chunk_size   = 0;
+    arena->retired_used = 0;
+    arena->total_size   = arena->first.size;
+    arena->high_water   = 0;
+    arena->file_len     = 0;
+    arena->floor        = 0;
+    arena->concurrent   = 0;
+    arena->id           = 0;
+    atomic_init(&arena->epoch, 0);
+    atomic_init(&arena->reserved, 0);
+    _nkit_arena_enter(arena, &arena->first);
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+nkit_arena_t* nkit_arena_create_ex(int node_id, size_t size, const nkit_arena_attr_t* attr) {
+    static const nkit_arena_attr_t defaults = { 0 };
+    if (!attr) attr = &defaults;
+    if (size == 0 || attr->page_size > NKIT_PAGE_1G) return NULL;
+    if (attr->prefault > NKIT_PREFAULT_PARALLEL) return NULL;
+    if (attr->policy > NKIT_POLICY_PREFERRED_MANY) return NULL;
+
+    // 1. Allocate the struct (cache-line aligned for the shared offset)
+    nkit_arena_t* arena = aligned_alloc(64, sizeof(nkit_arena_t));
+    if (!arena) return NULL;
+
+    // 2. Align size up to 2MB to be safe for Hugepages
+    size_t aligned_size = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+
+    // 3. Map and bind the initial chunk (spilled like later ones, see grow)
+    int node = node_id;
+    if (attr->spill && attr->policy == NKIT_POLICY_BIND && !attr->nodemask) {
+        node = _nkit_pressure_spill_node(node_id);
+    }
+    arena->first.base = _nkit_arena_map(node, &aligned_size, attr, &arena->first);
+    if (!arena->first.base) {
+        free(arena);
+        return NULL;
+    }
+    arena->first.size = aligned_size;
+    arena->first.next = NULL;
+    _nkit_arena_init(arena, node_id, attr);
+
+    // 4. Optionally fault everything in before handing the arena out
+    _nkit_arena_prefault(arena, &arena->first);
+    _nkit_chunk_account(&arena->first, 1);
+
     return arena;
 }
 
+int _nkit_arena_node(const nkit_arena_t* arena) {
+    return arena->node_id;
+}
+
+nkit_arena_t* nkit_arena_create(int node_id, size_t size) {
+    return nkit_arena_create_ex(node_id, size, NULL);
+}
+
+nkit_arena_t* nkit_arena_create_growable(int node_id, size_t chunk_size) {
+    return nkit_arena_create_growable_ex(node_id, chunk_size, NULL);
+}
+
+nkit_arena_t* nkit_arena_create_growable_ex(int node_id, size_t chunk_size,
+                                            const nkit_arena_attr_t* attr) {
+    nkit_arena_t* arena = nkit_arena_create_ex(node_id, chunk_size, attr);
+    if (!arena) return NULL;
+
+    // Every growth step maps at least one full (2MB aligned) chunk
+    arena->chunk_size = arena->first.size;
+    return arena;
+}
+
+nkit_arena_t* nkit_arena_create_concurrent(int node_id, size_t size) {
+    nkit_arena_t* arena = nkit_arena_create(node_id, size);
+    if (!arena) return NULL;
+
+    arena->concurrent = 1;
+    arena->id = atomic_fetch_add_explicit(&g_arena_ids, 1, memory_order_relaxed) + 1;
+    return arena;
+}
+
+/**
+ * @brief Bump 'size' bytes at the next 'align' boundary (power of two).
+ */
+static inline void* _nkit_arena_bump(nkit_arena_t* arena, size_t size, size_t align) {
+    // Shared arenas bump inside a per-thread sub-block
+    if (arena->concurrent) {
+        return _nkit_arena_alloc_concurrent(arena, size, align);
+    }
+
+    // 1. Check capacity of the current chunk
+    size_t off = _nkit_align_offset(arena->base, arena->used, align);
+    if (off > arena->size || arena->size - off < size) {
+        // Growable arenas chain the next chunk; fixed arenas are full
+        return _nkit_arena_grow(arena, size, align);
+    }
+
+    // 2. Bump pointer
+    arena->used = off + size;
+    return (char*)arena->base + off;
+}
+
 void* nkit_arena_alloc(nkit_arena_t* arena, size_t size) {
     if (!arena) return NULL;
 
-    // 1. Align allocation to 64 bytes (Cache Line)
+    // Align allocation to 64 bytes (Cache Line)
     // This prevents false sharing between objects allocated sequentially.
-    size_t aligned_size = (size + 63) & ~63;
+    size_t aligned_size = (size + 63) & ~(size_t)63;
+    if (aligned_size < size) return NULL;
 
-    // 2. Check capacity
-    if (arena->used + aligned_size > arena->size) {
-        return NULL; // Out of memory in this arena
-    }
+    return _nkit_arena_bump(arena, aligned_size, 64);
+}
+
+void* nkit_arena_alloc_aligned(nkit_arena_t* arena, size_t size, size_t align) {
+    if (!arena || align == 0 || (align & (align - 1)) != 0) return NULL;
+    if (size > SIZE_MAX - align) return NULL;
+    return _nkit_arena_bump(arena, size, align);
+}
 
-    // 3. Bump pointer
-    void* ptr = (char*)arena->base + arena->used;
-    arena->used += aligned_size;
+void* nkit_arena_alloc_packed(nkit_arena_t* arena, size_t size) {
+    if (!arena || size == SIZE_MAX) return NULL;
+    return _nkit_arena_bump(arena, size, 1);
+}
 
-    return ptr;
+void* nkit_arena_alloc_array(nkit_arena_t* arena, size_t count, size_t elem_size, size_t align) {
+    if (elem_size != 0 && count > SIZE_MAX / elem_size) return NULL;
+    return nkit_arena_alloc_aligned(arena, count * elem_size, align);
 }
 
 void nkit_arena_destroy(nkit_arena_t* arena) {
     if (arena) {
-        if (arena->base && arena->base != MAP_FAILED) {
-            munmap(arena->base, arena->size);
+        nkit_arena_chunk_t* c = arena->first.next;
+        while (c) {
+            nkit_arena_chunk_t* next = c->next;
+            _nkit_chunk_account(c, -1);
+            munmap(c->base, c->size);
+            free(c);
+            c = next;
+        }
+        if (arena->first.base) {
+            _nkit_chunk_account(&arena->first, -1);
+            munmap(arena->first.base, arena->first.size);
         }
         free(arena);
     }
@@ -112,41 +852,77 @@ void nkit_arena_destroy(nkit_arena_t* arena) {
 
 void nkit_arena_reset(nkit_arena_t* arena) {
     if (arena) {
-        arena->used = 0;
+        // Nothing is released: remember how deep the arena got, so the
+        // next rewind still drops those pages
+        size_t pos = arena->retired_used + _nkit_arena_watermark(arena);
+        if (pos > arena->high_water) arena->high_water = pos;
+
+        // Rewind to the first chunk; later chunks stay mapped for reuse
+        arena->retired_used = 0;
+        _nkit_arena_enter(arena, &arena->first);
+        arena->used = arena->floor;  // File contents stay allocated
+
+        // Concurrent arenas: rewind the shared offset and retire every TLAB
+        atomic_store_explicit(&arena->reserved, 0, memory_order_relaxed);
+        atomic_fetch_add_explicit(&arena->epoch, 1, memory_order_release);
     }
 }
 
+size_t nkit_arena_trim(nkit_arena_t* arena) {
+    if (!arena) return 0;
+
+    size_t released = 0;
+    nkit_arena_chunk_t* c = arena->current->next;
+    arena->current->next = NULL;
+
+    while (c) {
+        nkit_arena_chunk_t* next = c->next;
+        _nkit_chunk_account(c, -1);
+        munmap(c->base, c->size);
+        released += c->size;
+        free(c);
+        c = next;
+    }
+
+    arena->total_size -= released;
+
+    // Nothing dirty is left past the end of the current chunk
+    size_t mapped = arena->retired_used + arena->current->size;
+    if (arena->high_water > mapped) arena->high_water = mapped;
+    return released;
+}
+
 // ---------------------------------------------------------------------------
 // Hugepage Coalescing
 // ---------------------------------------------------------------------------
 
-size_t nkit_arena_coalesce(nkit_arena_t* arena) {
-    if (!arena) return 0;
-    if (!arena->base || arena->base == MAP_FAILED) return 0;
-    if (arena->size == 0) return 0;
-
-    // Determine the page size to use for coalescing.
-    // For hugepage-backed arenas we use 2MB; for standard pages we use
-    // the normal page size (typically 4KB).
-    size_t page_size = arena->use_huge ? HUGE_PAGE_SIZE : (size_t)sysconf(_SC_PAGESIZE);
+/**
+ * @brief Return every whole page of 'chunk' above offset 'used' to the OS.
+ * @return Number of pages returned.
+ */
+static size_t _nkit_chunk_coalesce(nkit_arena_chunk_t* chunk, size_t used) {
+    // Determine the page size to use for coalescing: the hugetlbfs page
+    // size (2MB or 1GB) for hugepage-backed chunks, the normal page size
+    // (typically 4KB) otherwise. THP chunks are split by the kernel as needed.
+    size_t page_size = chunk->page_bytes;
     if (page_size == 0) return 0;
 
     // Find the first page boundary ABOVE the current watermark.
-    // Everything from that point to the end of the arena is unused.
-    uintptr_t base_addr = (uintptr_t)arena->base;
-    uintptr_t used_end  = base_addr + arena->used;
+    // Everything from that point to the end of the chunk is unused.
+    uintptr_t base_addr = (uintptr_t)chunk->base;
+    uintptr_t used_end  = base_addr + used;
 
     // Align used_end UP to the next page boundary
     uintptr_t first_free_page = (used_end + page_size - 1) & ~(page_size - 1);
 
-    // End of the arena (already page-aligned from create)
-    uintptr_t arena_end = base_addr + arena->size;
+    // End of the chunk (already page-aligned from create)
+    uintptr_t chunk_end = base_addr + chunk->size;
 
-    if (first_free_page >= arena_end) {
+    if (first_free_page >= chunk_end) {
         return 0; // No full pages to return
     }
 
-    size_t free_bytes = arena_end - first_free_page;
+    size_t free_bytes = chunk_end - first_free_page;
     size_t pages_to_return = free_bytes / page_size;
 
     if (pages_to_return == 0) return 0;
@@ -162,18 +938,90 @@ size_t nkit_arena_coalesce(nkit_arena_t* arena) {
     return pages_to_return;
 }
 
+size_t nkit_arena_coalesce(nkit_arena_t* arena) {
+    if (!arena) return 0;
+    if (!arena->base || arena->base == MAP_FAILED) return 0;
+    if (arena->size == 0) return 0;
+
+    // The current chunk is released above its watermark; chunks retained
+    // after it (e.g. following a reset) are released entirely.
+    size_t used = _nkit_arena_watermark(arena);
+    size_t pages = _nkit_chunk_coalesce(arena->current, used);
+    for (nkit_arena_chunk_t* c = arena->current->next; c; c = c->next) {
+        pages += _nkit_chunk_coalesce(c, 0);
+    }
+
+    // Everything above the position is released now
+    arena->high_water = arena->retired_used + used;
+
+    return pages;
+}
+
+// ---------------------------------------------------------------------------
+// Checkpoints
+// ---------------------------------------------------------------------------
+
+nkit_arena_mark_t nkit_arena_mark(nkit_arena_t* arena) {
+    nkit_arena_mark_t mark = { 0 };
+    if (!arena || arena->concurrent) return mark;
+
+    mark.chunk   = arena->current;
+    mark.used    = arena->used;
+    mark.retired = arena->retired_used;
+    return mark;
+}
+
+int nkit_arena_rewind(nkit_arena_t* arena, nkit_arena_mark_t mark) {
+    if (!arena || arena->concurrent || !mark.chunk) return -1;
+
+    // A mark is only valid while the arena has not moved below it
+    size_t pos = arena->retired_used + arena->used;
+    size_t target = mark.retired + mark.used;
+    if (target > pos) return -1;
+
+    nkit_arena_chunk_t* c = &arena->first;
+    while (c != mark.chunk && c != arena->current) c = c->next;
+    if (c != mark.chunk) return -1;
+
+    // Bumping only moves forward, so 'pos' is the deepest offset since the
+    // last rewind; high_water remembers what earlier rewinds kept. Pages
+    // dirtied before a reset may lie in chunks past the current one: walk
+    // the whole kept chain then.
+    nkit_arena_chunk_t* deepest = arena->current;
+    if (arena->high_water > pos) {
+        while (deepest->next) deepest = deepest->next;
+    } else {
+        arena->high_water = pos;
+    }
+
+    arena->retired_used = mark.retired;
+    _nkit_arena_enter(arena, c);
+    arena->used = mark.used;
+
+    // Scratch burst deeper than the slack: release it like nkit_arena_coalesce
+    if (arena->high_water > target + SCRATCH_KEEP) {
+        _nkit_chunk_coalesce(c, mark.used + SCRATCH_KEEP);
+        while (c != deepest) {
+            c = c->next;
+            _nkit_chunk_coalesce(c, 0);
+        }
+        arena->high_water = target + SCRATCH_KEEP;
+    }
+    return 0;
+}
+
 // ---------------------------------------------------------------------------
 // Arena Query Functions
 // ---------------------------------------------------------------------------
 
 size_t nkit_arena_used(nkit_arena_t* arena) {
     if (!arena) return 0;
-    return arena->used;
+    return arena->retired_used + _nkit_arena_watermark(arena);
 }
 
 size_t nkit_arena_size(nkit_arena_t* arena) {
     if (!arena) return 0;
-    return arena->size;
+    return arena->total_size;
 }
 
 int nkit_arena_is_huge(nkit_arena_t* arena) {
@@ -181,3 +1029,171 @@ int nkit_arena_is_huge(nkit_arena_t* arena) {
     return arena->use_huge;
 }
 
+nkit_page_size_t nkit_arena_backing(nkit_arena_t* arena) {
+    if (!arena) return NKIT_PAGE_DEFAULT;
+    return arena->backing;
+}
+
+uint64_t nkit_arena_prefault_ns(nkit_arena_t* arena) {
+    if (!arena) return 0;
+    return arena->prefault_ns;
+}
+
+size_t nkit_arena_page_size(nkit_arena_t* arena) {
+    if (!arena) return 0;
+    switch (arena->backing) {
+        case NKIT_PAGE_1G:  return GIGA_PAGE_SIZE;
+        case NKIT_PAGE_2M:
+        case NKIT_PAGE_THP: return HUGE_PAGE_SIZE;
+        default:            return (size_t)sysconf(_SC_PAGESIZE);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// File-Backed Arenas
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Map 'file_len' bytes of 'fd' followed by room for allocations.
+ *
+ * Writable shared mappings map the file over the whole arena, so
+ * allocations persist too. The file is only grown when the caller asks
+ * for more than it holds, and then to exactly that size (hugetlbfs files
+ * can only be sized in whole huge pages); the mapping may run past EOF
+ * into the partial last page. Otherwise an anonymous region is reserved
+ * and the file laid over its start (private copy-on-write, or read-only).
+ *
+ * @param size In: total bytes wanted. Out: bytes mapped (page multiple).
+ * @param chunk Has page_bytes set; receives file_bytes.
+ * @return Base address, or NULL on failure.
+ */
+static void* _nkit_map_file(int fd, size_t file_len, size_t* size,
+                            const nkit_arena_file_attr_t* attr, nkit_arena_chunk_t* chunk) {
+    size_t page = chunk->page_bytes;
+    size_t want = *size > file_len ? *size : file_len;
+    size_t span = (want + page - 1) & ~(page - 1);
+    size_t file_span = (file_len + page - 1) & ~(page - 1);
+
+    if (attr->shared && !attr->readonly) {
+        size_t new_len = chunk->use_huge ? span : *size;
+        if (*size > file_len && ftruncate(fd, (off_t)new_len) != 0) return NULL;
+        void* base = mmap(NULL, span, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) return NULL;
+        chunk->file_bytes = span;
+        *size = span;
+        return base;
+    }
+
+    // Reserve the whole range, aligned for the file's pages
+    size_t sys_page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t slack = page > sys_page ? page : 0;
+    char* raw = mmap(NULL, span + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+
+    char* base = (char*)(((uintptr_t)raw + page - 1) & ~(uintptr_t)(page - 1));
+    if (base > raw) munmap(raw, (size_t)(base - raw));
+    size_t tail = (size_t)((raw + span + slack) - (base + span));
+    if (tail) munmap(base + span, tail);
+
+    if (file_span) {
+        int prot = attr->readonly ? PROT_READ : PROT_READ | PROT_WRITE;
+        int flags = (attr->shared ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED;
+        if (mmap(base, file_span, prot, flags, fd, 0) == MAP_FAILED) {
+            munmap(base, span);
+            return NULL;
+        }
+    }
+    chunk->file_bytes = file_span;
+    *size = span;
+    return base;
+}
+
+nkit_arena_t* nkit_arena_create_file(int node_id, const char* path, size_t size,
+                                     const nkit_arena_file_attr_t* attr) {
+    static const nkit_arena_file_attr_t defaults = { 0 };
+    if (!attr) attr = &defaults;
+    if (!path || attr->arena.prefault > NKIT_PREFAULT_PARALLEL ||
+        attr->arena.policy > NKIT_POLICY_PREFERRED_MANY) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    // 1. Open (shared writable arenas may create the file) and size it up
+    int writable = attr->shared && !attr->readonly;
+    int fd = open(path, writable ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC, 0600);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    struct statfs fs;
+    if (fstat(fd, &st) != 0 || fstatfs(fd, &fs) != 0) goto fail_fd;
+    if (!S_ISREG(st.st_mode) || (st.st_size == 0 && size == 0)) {
+        errno = EINVAL;
+        goto fail_fd;
+    }
+    size_t file_len = (size_t)st.st_size;
+
+    nkit_arena_t* arena = aligned_alloc(64, sizeof(nkit_arena_t));
+    if (!arena) goto fail_fd;
+
+    // 2. The file system decides the page size: hugetlbfs files come in
+    //    its huge pages, everything else in base pages
+    nkit_arena_chunk_t* chunk = &arena->first;
+    if ((unsigned long)fs.f_type == HUGETLBFS_MAGIC) {
+        chunk->use_huge   = 1;
+        chunk->page_bytes = (size_t)fs.f_bsize;
+        chunk->backing    = chunk->page_bytes >= GIGA_PAGE_SIZE ? NKIT_PAGE_1G : NKIT_PAGE_2M;
+    } else {
+        chunk->use_huge   = 0;
+        chunk->page_bytes = (size_t)sysconf(_SC_PAGESIZE);
+        chunk->backing    = NKIT_PAGE_4K;
+    }
+    chunk->node = node_id;
+    chunk->next = NULL;
+
+    size_t mapped = size;
+    chunk->base = _nkit_map_file(fd, file_len, &mapped, attr, chunk);
+    close(fd);
+    if (!chunk->base) {
+        free(arena);
+        return NULL;
+    }
+    chunk->size = mapped;
+
+    // 3. Place the mapping: sets the policy for shmem/hugetlbfs pages and
+    //    the anonymous tail, migrates whatever is already mapped
+    if (_nkit_arena_place(chunk->base, mapped, node_id, &attr->arena, chunk->page_bytes) != 0) {
+        munmap(chunk->base, mapped);
+        free(arena);
+        return NULL;
+    }
+
+    _nkit_arena_init(arena, node_id, &attr->arena);
+    arena->file_len = file_len;
+    arena->floor = attr->readonly ? chunk->file_bytes : file_len;
+    arena->used = arena->floor;
+
+    // 4. Read the file in from the target node. Pages another process had
+    //    cached elsewhere are only mapped by now: move them where allowed.
+    _nkit_arena_prefault(arena, chunk);
+    if (attr->arena.prefault != NKIT_PREFAULT_NONE && chunk->file_bytes) {
+        _nkit_arena_place(chunk->base, chunk->file_bytes, node_id, &attr->arena, chunk->page_bytes);
+    }
+    _nkit_chunk_account(chunk, 1);
+    return arena;
+
+fail_fd:
+    close(fd);
+    return NULL;
+}
+
+void* nkit_arena_file_data(nkit_arena_t* arena, size_t* bytes) {
+    if (bytes) *bytes = arena ? arena->file_len : 0;
+    if (!arena || !arena->first.file_bytes) return NULL;
+    return arena->first.base;
+}
+
+int nkit_arena_sync(nkit_arena_t* arena) {
+    if (!arena) return -1;
+    if (!arena->first.file_bytes) return 0;
+    return msync(arena->first.base, arena->first.file_bytes, MS_SYNC);
+}
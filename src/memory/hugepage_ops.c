@@ -1,13 +1,19 @@
 #define _GNU_SOURCE
 
 #include "../internal.h"
+#include <pthread.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
-size_t _nkit_get_hugepage_size(void) {
+// The default hugepage size is fixed at boot: read it once, not on
+// every chunk map
+static size_t         g_hugepage_size;
+static pthread_once_t g_hugepage_once = PTHREAD_ONCE_INIT;
+
+static void _hugepage_size_init(void) {
     FILE* fp = fopen("/proc/meminfo", "r");
-    if (!fp) return 0;
+    if (!fp) return;
 
     char line[128];
     size_t size_kb = 0;
@@ -22,6 +28,11 @@ size_t _nkit_get_hugepage_size(void) {
     }
     fclose(fp);
 
-    // Return in bytes (0 if not found)
-    return size_kb * 1024;
+    // In bytes (0 if not found)
+    g_hugepage_size = size_kb * 1024;
+}
+
+size_t _nkit_get_hugepage_size(void) {
+    pthread_once(&g_hugepage_once, _hugepage_size_init);
+    return g_hugepage_size;
 }
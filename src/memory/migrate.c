@@ -3,10 +3,15 @@
 #include <errno.h>
 #include <numa.h>
 #include <numaif.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <numakit/memory.h>
+#include "../internal.h"
 
 int nkit_memory_migrate(void *ptr, size_t size, int target_node) {
     if (numa_available() < 0 || target_node > numa_max_node()) {
@@ -33,6 +38,7 @@ int nkit_memory_migrate(void *ptr, size_t size, int target_node) {
                     mask->size + 1, MPOL_MF_MOVE);
 
     numa_free_nodemask(mask);
+    nkit_memory_residency_invalidate(ptr, size);
 
     if (ret != 0) {
         // errno is set by mbind (e.g., EPERM if memory is locked)
@@ -40,3 +46,256 @@ int nkit_memory_migrate(void *ptr, size_t size, int target_node) {
     }
     return 0;
 }
+
+long nkit_memory_page_nodes(const void *ptr, size_t size, int *nodes) {
+    if (!ptr || !nodes || size == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t first = (uintptr_t)ptr & ~(uintptr_t)(page_size - 1);
+    uintptr_t last  = ((uintptr_t)ptr + size - 1) & ~(uintptr_t)(page_size - 1);
+    unsigned long count = (unsigned long)((last - first) / page_size + 1);
+
+    // On UMA systems this probes residency with mincore instead, so
+    // absent pages report -ENOENT on both paths
+    if (_nkit_query_pages(first, count, page_size, nodes) != 0) {
+        return -1;
+    }
+    return (long)count;
+}
+
+// ---------------------------------------------------------------------------
+// Asynchronous Migration Service
+// ---------------------------------------------------------------------------
+#define MIGRATE_DEFAULT_BATCH 512
+
+struct nkit_migration_s {
+    nkit_migration_t *next;      // Service FIFO link
+    uintptr_t         base;      // First page
+    size_t            npages;
+    int               target_node;
+    int              *status;    // Per-page node or -errno
+    atomic_size_t     moved;     // Pages now on target_node
+    atomic_int        done;
+    pthread_mutex_t   lock;
+    pthread_cond_t    cond;
+};
+
+struct nkit_migrator_s {
+    pthread_t         worker;
+    pthread_mutex_t   lock;      // Protects the FIFO and stop
+    pthread_cond_t    cond;
+    nkit_migration_t *head;
+    nkit_migration_t *tail;
+    int               stop;
+
+    size_t            batch_pages;
+    double            bytes_per_ns;  // 0 = unlimited
+    long              page_size;
+};
+
+static inline uint64_t _migrate_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Sleep until 'bytes' fit the rate limit, measured from 'start'.
+ */
+static void _migrate_pace(const nkit_migrator_t *mig, uint64_t start, size_t bytes) {
+    if (mig->bytes_per_ns <= 0) return;
+
+    uint64_t due = start + (uint64_t)((double)bytes / mig->bytes_per_ns);
+    uint64_t now = _migrate_now_ns();
+    if (due <= now) return;
+
+    struct timespec ts = {
+        .tv_sec  = (time_t)((due - now) / 1000000000ULL),
+        .tv_nsec = (long)((due - now) % 1000000000ULL)
+    };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {}
+}
+
+/**
+ * @brief Move one request in batches, filling its per-page status.
+ */
+static void _migrate_run(nkit_migrator_t *mig, nkit_migration_t *m,
+                         void **pages, int *nodes) {
+    for (size_t i = 0; i < mig->batch_pages; i++) nodes[i] = m->target_node;
+
+    for (size_t done = 0; done < m->npages; done += mig->batch_pages) {
+        size_t n = m->npages - done;
+        if (n > mig->batch_pages) n = mig->batch_pages;
+
+        for (size_t i = 0; i < n; i++) {
+            pages[i] = (void *)(m->base + (done + i) * (uintptr_t)mig->page_size);
+        }
+
+        uint64_t start = _migrate_now_ns();
+        int *status = m->status + done;
+        if (move_pages(0, n, pages, nodes, status, MPOL_MF_MOVE) < 0) {
+            // Whole batch rejected (e.g. EPERM): record why for every page
+            for (size_t i = 0; i < n; i++) status[i] = -errno;
+        }
+
+        size_t moved = 0;
+        for (size_t i = 0; i < n; i++) moved += status[i] == m->target_node;
+        atomic_fetch_add_explicit(&m->moved, moved, memory_order_relaxed);
+
+        _migrate_pace(mig, start, n * (size_t)mig->page_size);
+    }
+}
+
+static void _migrate_complete(nkit_migration_t *m, size_t page_size) {
+    nkit_memory_residency_invalidate((void *)m->base, m->npages * page_size);
+
+    pthread_mutex_lock(&m->lock);
+    atomic_store_explicit(&m->done, 1, memory_order_release);
+    pthread_cond_broadcast(&m->cond);
+    pthread_mutex_unlock(&m->lock);
+}
+
+static void *_migrate_worker(void *arg) {
+    nkit_migrator_t *mig = (nkit_migrator_t *)arg;
+
+    void **pages = malloc(mig->batch_pages * sizeof(void *));
+    int *nodes = malloc(mig->batch_pages * sizeof(int));
+
+    for (;;) {
+        pthread_mutex_lock(&mig->lock);
+        while (!mig->head && !mig->stop) {
+            pthread_cond_wait(&mig->cond, &mig->lock);
+        }
+        nkit_migration_t *m = mig->head;
+        if (m) {
+            mig->head = m->next;
+            if (!mig->head) mig->tail = NULL;
+        }
+        pthread_mutex_unlock(&mig->lock);
+
+        if (!m) break; // Stopped and drained
+
+        if (pages && nodes) {
+            _migrate_run(mig, m, pages, nodes);
+        } else {
+            for (size_t i = 0; i < m->npages; i++) m->status[i] = -ENOMEM;
+        }
+        _migrate_complete(m, (size_t)mig->page_size);
+    }
+
+    free(pages);
+    free(nodes);
+    return NULL;
+}
+
+nkit_migrator_t *nkit_migrator_create(const nkit_migrator_attr_t *attr) {
+    if (numa_available() < 0) return NULL;
+
+    nkit_migrator_t *mig = calloc(1, sizeof(nkit_migrator_t));
+    if (!mig) return NULL;
+
+    mig->page_size = sysconf(_SC_PAGESIZE);
+    mig->batch_pages = (attr && attr->batch_pages) ? attr->batch_pages : MIGRATE_DEFAULT_BATCH;
+    if (attr && attr->rate_limit_mbps > 0) {
+        mig->bytes_per_ns = attr->rate_limit_mbps * 1024.0 * 1024.0 / 1e9;
+    }
+
+    pthread_mutex_init(&mig->lock, NULL);
+    pthread_cond_init(&mig->cond, NULL);
+
+    if (pthread_create(&mig->worker, NULL, _migrate_worker, mig) != 0) {
+        pthread_cond_destroy(&mig->cond);
+        pthread_mutex_destroy(&mig->lock);
+        free(mig);
+        return NULL;
+    }
+    return mig;
+}
+
+nkit_migration_t *nkit_migrate_async(nkit_migrator_t *mig, void *ptr, size_t size, int target_node) {
+    if (!mig || !ptr || size == 0 || target_node < 0 || target_node > numa_max_node()) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    uintptr_t first = (uintptr_t)ptr & ~(uintptr_t)(mig->page_size - 1);
+    uintptr_t last  = ((uintptr_t)ptr + size - 1) & ~(uintptr_t)(mig->page_size - 1);
+
+    nkit_migration_t *m = calloc(1, sizeof(nkit_migration_t));
+    if (!m) return NULL;
+
+    m->base = first;
+    m->npages = (last - first) / (uintptr_t)mig->page_size + 1;
+    m->target_node = target_node;
+    m->status = malloc(m->npages * sizeof(int));
+    if (!m->status) {
+        free(m);
+        return NULL;
+    }
+    pthread_mutex_init(&m->lock, NULL);
+    pthread_cond_init(&m->cond, NULL);
+
+    pthread_mutex_lock(&mig->lock);
+    if (mig->tail) mig->tail->next = m;
+    else mig->head = m;
+    mig->tail = m;
+    pthread_cond_signal(&mig->cond);
+    pthread_mutex_unlock(&mig->lock);
+
+    return m;
+}
+
+int nkit_migration_done(const nkit_migration_t *m) {
+    if (!m) return 0;
+    return atomic_load_explicit(&((nkit_migration_t *)m)->done, memory_order_acquire);
+}
+
+long nkit_migration_wait(nkit_migration_t *m) {
+    if (!m) return -1;
+
+    pthread_mutex_lock(&m->lock);
+    while (!atomic_load_explicit(&m->done, memory_order_acquire)) {
+        pthread_cond_wait(&m->cond, &m->lock);
+    }
+    pthread_mutex_unlock(&m->lock);
+
+    return (long)(m->npages - atomic_load_explicit(&m->moved, memory_order_relaxed));
+}
+
+size_t nkit_migration_bytes_moved(const nkit_migration_t *m) {
+    if (!m) return 0;
+    size_t pages = atomic_load_explicit(&((nkit_migration_t *)m)->moved, memory_order_relaxed);
+    return pages * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+long nkit_migration_status(const nkit_migration_t *m, const int **status) {
+    if (!nkit_migration_done(m)) return -1;
+    if (status) *status = m->status;
+    return (long)m->npages;
+}
+
+void nkit_migration_free(nkit_migration_t *m) {
+    if (!m) return;
+    nkit_migration_wait(m);
+    pthread_cond_destroy(&m->cond);
+    pthread_mutex_destroy(&m->lock);
+    free(m->status);
+    free(m);
+}
+
+void nkit_migrator_destroy(nkit_migrator_t *mig) {
+    if (!mig) return;
+
+    pthread_mutex_lock(&mig->lock);
+    mig->stop = 1;
+    pthread_cond_signal(&mig->cond);
+    pthread_mutex_unlock(&mig->lock);
+
+    pthread_join(mig->worker, NULL);
+    pthread_cond_destroy(&mig->cond);
+    pthread_mutex_destroy(&mig->lock);
+    free(mig);
+}
@@ -0,0 +1,116 @@
+#define _GNU_SOURCE
+
+#include "../internal.h"
+#include <sys/mman.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/*
+ * Three-level radix tree over 48-bit virtual addresses at 4KB granularity:
+ *
+ *   [47..36] root index -> [35..24] mid index -> [23..12] leaf index
+ *
+ * Each level has 4096 slots (32KB). Interior nodes are mapped lazily,
+ * installed with a CAS and never freed, so readers walk the tree
+ * without locks. A leaf covers 16MB of address space.
+ */
+#define PAGEMAP_PAGE_SHIFT 12
+#define PAGEMAP_LEVEL_BITS 12
+#define PAGEMAP_FANOUT     (1UL << PAGEMAP_LEVEL_BITS)
+#define PAGEMAP_ADDR_BITS  48
+
+typedef struct {
+    _Atomic(const _nkit_page_owner_t*) slots[PAGEMAP_FANOUT];
+} nkit_pagemap_leaf_t;
+
+typedef struct {
+    _Atomic(nkit_pagemap_leaf_t*) slots[PAGEMAP_FANOUT];
+} nkit_pagemap_mid_t;
+
+static _Atomic(nkit_pagemap_mid_t*) g_pagemap_root[PAGEMAP_FANOUT];
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static inline size_t _idx(uintptr_t page, int level) {
+    return (page >> (PAGEMAP_LEVEL_BITS * (2 - level))) & (PAGEMAP_FANOUT - 1);
+}
+
+/**
+ * @brief Map a zeroed tree node (anonymous mmap, so untouched slots cost nothing).
+ */
+static void* _pagemap_node_alloc(size_t size) {
+    void* node = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return node == MAP_FAILED ? NULL : node;
+}
+
+/**
+ * @brief Return the child at 'slot', installing a fresh one if empty.
+ */
+static void* _pagemap_child(_Atomic(void*)* slot, size_t size) {
+    void* child = atomic_load_explicit(slot, memory_order_acquire);
+    if (child) return child;
+
+    void* fresh = _pagemap_node_alloc(size);
+    if (!fresh) return NULL;
+
+    if (!atomic_compare_exchange_strong_explicit(slot, &child, fresh,
+                                                 memory_order_acq_rel,
+                                                 memory_order_acquire)) {
+        // Lost the race: use the winner's node
+        munmap(fresh, size);
+        return child;
+    }
+    return fresh;
+}
+
+static nkit_pagemap_leaf_t* _pagemap_leaf(uintptr_t page, int create) {
+    _Atomic(void*)* root_slot = (_Atomic(void*)*)&g_pagemap_root[_idx(page, 0)];
+    nkit_pagemap_mid_t* mid = create
+        ? _pagemap_child(root_slot, sizeof(nkit_pagemap_mid_t))
+        : atomic_load_explicit(root_slot, memory_order_acquire);
+    if (!mid) return NULL;
+
+    _Atomic(void*)* mid_slot = (_Atomic(void*)*)&mid->slots[_idx(page, 1)];
+    return create
+        ? _pagemap_child(mid_slot, sizeof(nkit_pagemap_leaf_t))
+        : atomic_load_explicit(mid_slot, memory_order_acquire);
+}
+
+// ---------------------------------------------------------------------------
+// Internal API
+// ---------------------------------------------------------------------------
+
+int _nkit_pagemap_set(const void* addr, size_t len, const _nkit_page_owner_t* owner) {
+    if (len == 0) return 0;
+
+    uintptr_t first = (uintptr_t)addr >> PAGEMAP_PAGE_SHIFT;
+    uintptr_t last  = ((uintptr_t)addr + len - 1) >> PAGEMAP_PAGE_SHIFT;
+    if ((last >> (PAGEMAP_ADDR_BITS - PAGEMAP_PAGE_SHIFT)) != 0) return -1;
+
+    nkit_pagemap_leaf_t* leaf = NULL;
+    for (uintptr_t page = first; page <= last; page++) {
+        size_t i = _idx(page, 2);
+        if (!leaf || i == 0) {
+            // Clearing never needs to build the path
+            leaf = _pagemap_leaf(page, owner != NULL);
+            if (!leaf) {
+                if (owner) return -1;
+                page |= PAGEMAP_FANOUT - 1; // Skip the missing leaf
+                continue;
+            }
+        }
+        atomic_store_explicit(&leaf->slots[i], owner, memory_order_release);
+    }
+    return 0;
+}
+
+const _nkit_page_owner_t* _nkit_pagemap_get(const void* addr) {
+    uintptr_t page = (uintptr_t)addr >> PAGEMAP_PAGE_SHIFT;
+    if ((page >> (PAGEMAP_ADDR_BITS - PAGEMAP_PAGE_SHIFT)) != 0) return NULL;
+
+    nkit_pagemap_leaf_t* leaf = _pagemap_leaf(page, 0);
+    if (!leaf) return NULL;
+    return atomic_load_explicit(&leaf->slots[_idx(page, 2)], memory_order_acquire);
+}
@@ -3,44 +3,197 @@
 #include <numakit/memory.h>
 #include <numakit/topology.h>
 #include <numakit/sched.h>
+#include <numakit/sync.h>
 #include <numakit/numakit.h>
 #include "../internal.h"
+#include <numa.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <stdalign.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define NUM_SIZE_CLASSES 10
 #define MAX_NODES 64 // Reasonable upper bound for topology
 
-// Predefined size classes from 32B up to 16KB
-static const size_t SIZE_CLASSES[NUM_SIZE_CLASSES] = {
-    32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384
+// Size-class lookup: one byte per 16-byte step up to the largest small size
+#define CLASS_QUANTUM        16
+#define CLASS_LOOKUP_ENTRIES (NKIT_MEMPOOL_MAX_SMALL / CLASS_QUANTUM + 1)
+
+/*
+ * Default size classes, jemalloc-style: 16-byte steps up to 128B, then
+ * four classes per power of two (quarter-power steps), up to 16KB.
+ * Worst-case internal fragmentation drops from 50% to 20%.
+ */
+#define NUM_DEFAULT_CLASSES 36
+static const size_t DEFAULT_CLASSES[NUM_DEFAULT_CLASSES] = {
+       16,    32,    48,    64,    80,    96,   112,   128,
+      160,   192,   224,   256,   320,   384,   448,   512,
+      640,   768,   896,  1024,  1280,  1536,  1792,  2048,
+     2560,  3072,  3584,  4096,  5120,  6144,  7168,  8192,
+    10240, 12288, 14336, 16384
 };
 
-// Initial capacity per size class (number of objects)
-// For simplicity, we use a fixed capacity here. In a production system,
-// larger object sizes might have fewer slots to save memory.
-#define INITIAL_CAPACITY_PER_SLAB 1024
+/*
+ * Default class of an s-byte request as a constant expression, so the
+ * lookup table below is generated by the compiler. Above 128B the class
+ * is 8 + 4 * (lg - 7) + (the two bits after the leading one of s - 1).
+ */
+#define _NKIT_LG(x) ((x) >= 8192 ? 13 : (x) >= 4096 ? 12 : (x) >= 2048 ? 11 : \
+                     (x) >= 1024 ? 10 : (x) >= 512  ? 9  : (x) >= 256  ? 8  : 7)
+#define _NKIT_DCLASS(s) ((s) == 0 ? 0 : (s) <= 128 ? ((s) + 15) / 16 - 1 : \
+                         8 + 4 * (_NKIT_LG((s) - 1) - 7) +                  \
+                         ((((s) - 1) >> (_NKIT_LG((s) - 1) - 2)) & 3))
+
+#define _C(i)     (uint8_t)_NKIT_DCLASS((i) * CLASS_QUANTUM),
+#define _R4(i)    _C(i) _C((i) + 1) _C((i) + 2) _C((i) + 3)
+#define _R16(i)   _R4(i) _R4((i) + 4) _R4((i) + 8) _R4((i) + 12)
+#define _R64(i)   _R16(i) _R16((i) + 16) _R16((i) + 32) _R16((i) + 48)
+#define _R256(i)  _R64(i) _R64((i) + 64) _R64((i) + 128) _R64((i) + 192)
+#define _R1024(i) _R256(i) _R256((i) + 256) _R256((i) + 512) _R256((i) + 768)
+
+// Class index of a request, by (size + 15) / 16
+static const uint8_t DEFAULT_CLASS_OF[CLASS_LOOKUP_ENTRIES] = { _R1024(0) _C(1024) };
+
+#undef _C
+#undef _R4
+#undef _R16
+#undef _R64
+#undef _R256
+#undef _R1024
+
+_Static_assert(CLASS_LOOKUP_ENTRIES == 1025, "lookup table generator covers 1025 entries");
+_Static_assert(_NKIT_DCLASS(16384) == NUM_DEFAULT_CLASSES - 1, "default table ends at 16KB");
+_Static_assert(_NKIT_DCLASS(160) == 8 && _NKIT_DCLASS(161) == 9 && _NKIT_DCLASS(257) == 12,
+               "default classes are quarter-power steps");
+
+// Objects in the first slab extent of a size class. The class slabs are
+// unbounded (later extents double), so a class only borrows remote
+// memory once its node is out of memory.
+#define EXTENT_CAPACITY_PER_SLAB 1024
+#define MAX_EXTENTS_PER_SLAB     0
+
+// Default alignment for memory pool blocks (cache line). Small classes
+// are aligned to their largest power-of-two divisor up to a page, so
+// e.g. the 256B class also serves 256B-aligned requests.
+#define MEMPOOL_ALIGN   64
+#define CLASS_MAX_ALIGN 4096
+
+// Thread cache geometry: objects cached per size class, and how many
+// objects move between a magazine and its slab in one refill/flush.
+#define MAGAZINE_SIZE  64
+#define MAGAZINE_BATCH (MAGAZINE_SIZE / 2)
 
-// Default alignment for memory pool blocks (cache line)
-#define MEMPOOL_ALIGN 64
+// Cross-node frees are collected per destination node and posted to its
+// inbox this many at a time (one CAS on the remote cache line per batch).
+#define REMOTE_BATCH 32
+
+// Large-object tier (above the biggest size class): page-granular spans
+// carved from 2MB hugepage-backed runs of a per-node growable arena.
+#define LARGE_PAGE       4096UL
+#define LARGE_RUN_SIZE   (2UL * 1024 * 1024)
+#define LARGE_PREFIX     MEMPOOL_ALIGN          // Span descriptor
+#define LARGE_SIZE_CLASS UINT32_MAX             // Page-map tag for large spans
+#define LARGE_CACHE_MAX  (64UL * 1024 * 1024)   // Warm free bytes kept per node
+
+/*
+ * Blocks carry no header. Every slab extent registers its pages in the
+ * page map with { owner = slab, tag = size class, node }, so a bare
+ * pointer resolves to its slab, class and home node with one radix
+ * lookup. A 32-byte class therefore really costs 32 bytes per object.
+ */
 
 /**
- * @brief Internal header for each allocation.
+ * @brief Descriptor at the start of every large span (page aligned).
  *
- * Placed immediately before the user's data pointer.
- * It stores a back-pointer to the slab that originated the allocation,
- * enabling O(1) deallocation without complex page mapping.
+ * The user pointer is span + LARGE_PREFIX, inside the span's first page.
+ * That page is registered in the page map with 'desc' (tag
+ * LARGE_SIZE_CLASS) while the span is live, so nkit_mempool_free() tells
+ * both tiers apart with the same lookup.
+ */
+typedef struct nkit_large_span_s {
+    _nkit_page_owner_t desc;         // owner = span, tag, node
+    size_t size;                     // Span bytes, prefix included
+    struct nkit_large_span_s* next;  // Free-list link (free spans only)
+} nkit_large_span_t;
+
+/**
+ * @brief Per-node large-object state.
+ *
+ * Free spans are kept address-ordered and coalesced, so recently freed
+ * spans are reused (first-fit, split on demand) before a new run is
+ * carved. Warm spans keep their pages; once they pass LARGE_CACHE_MAX
+ * bytes, the span just freed is returned to the OS with MADV_DONTNEED
+ * and moves to the cold list, where it still serves later requests.
  */
 typedef struct {
-    nkit_slab_t* owner_slab;
-} nkit_mempool_header_t;
+    pthread_mutex_t    lock;
+    nkit_arena_t*      runs;    // Created on first use
+    nkit_large_span_t* free;    // Address-ordered warm free spans
+    nkit_large_span_t* cold;    // Address-ordered purged free spans
+    size_t             cached;  // Bytes in 'free' (bounded by LARGE_CACHE_MAX)
+    size_t             purged;  // Bytes in 'cold'
+} nkit_mempool_large_t;
+
+/**
+ * @brief Per-thread stack of free objects for one size class.
+ */
+typedef struct {
+    uint32_t count;
+    void*    objs[MAGAZINE_SIZE];  // Free blocks of one class, home node of the tcache
+} nkit_magazine_t;
+
+/**
+ * @brief Objects freed by this thread that belong to another node.
+ *
+ * A private singly-linked list threaded through the first word of each
+ * user block; posted to the owner's inbox in one piece.
+ */
+typedef struct {
+    void*    head;
+    void*    tail;
+    uint32_t count;
+} nkit_remote_batch_t;
+
+/**
+ * @brief Per-thread, per-pool cache (tcache).
+ *
+ * Only the owning thread touches the magazines, so the alloc/free fast
+ * path is a plain array push/pop. Every cached object belongs to the
+ * slab of 'node' for its size class; objects from other nodes are
+ * batched in 'remote' and posted to their owner's inbox.
+ */
+typedef struct nkit_mempool_tcache_s {
+    struct nkit_mempool_s*        pool;
+    int                           node;  // Node the magazines are filled from
+    struct nkit_mempool_tcache_s* prev;  // Registry links (under tcache_lock)
+    struct nkit_mempool_tcache_s* next;
+    nkit_remote_batch_t           remote[MAX_NODES];  // Pending cross-node frees
+    nkit_magazine_t               mags[];             // One per pool size class
+} nkit_mempool_tcache_t;
+
+/**
+ * @brief Stored in a thread's tcache slot once thread exit has destroyed
+ *        its tcache. Shares the tcache's first field, so the key
+ *        destructor finds the pool from either.
+ */
+typedef struct {
+    struct nkit_mempool_s* pool;
+} nkit_mempool_retired_t;
 
 /**
  * @brief State for a single NUMA node.
  */
 typedef struct {
+    // Remote-free inbox: other nodes push whole batches with one CAS, the
+    // owning node takes everything with one exchange on its refill path.
+    // Kept on its own cache line so remote pushes don't hit the slab table.
+    alignas(64) _Atomic(void*) inbox;
     int logical_node_id;
-    nkit_slab_t* slabs[NUM_SIZE_CLASSES];
+    pthread_mutex_t slab_lock;  // Serializes lazy slab creation
+    _Atomic(nkit_slab_t*) slabs[NKIT_MEMPOOL_MAX_CLASSES];  // Created on first use
+    nkit_mempool_large_t large;
 } nkit_mempool_node_t;
 
 /**
@@ -48,16 +201,544 @@ typedef struct {
  */
 struct nkit_mempool_s {
     int num_nodes;
+    int num_classes;
+    size_t         max_small;      // Largest class; bigger requests are large
+    const uint8_t* class_of;       // Class index by (size + 15) / 16
+    const size_t*  class_size;     // Bytes per slot of each class
+    size_t         tcache_bytes;   // sizeof(tcache) + one magazine per class
+    pthread_key_t          tcache_key;   // Per-thread tcache (destructor flushes)
+    pthread_mutex_t        tcache_lock;  // Protects the tcache registry
+    nkit_mempool_tcache_t* tcaches;      // All live tcaches, freed on destroy
+    nkit_pcounter_t*       remote_frees; // Objects freed from a foreign node
+    nkit_mempool_retired_t retired;      // Tcache slot value after thread exit
     nkit_mempool_node_t nodes[MAX_NODES];
+
+    // Storage for custom class sets (the default set uses the static tables)
+    uint8_t custom_class_of[CLASS_LOOKUP_ENTRIES];
+    size_t  custom_class_size[NKIT_MEMPOOL_MAX_CLASSES];
 };
 
-nkit_mempool_t* nkit_mempool_create(void) {
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static inline int _size_class(nkit_mempool_t* pool, size_t size) {
+    return pool->class_of[(size + CLASS_QUANTUM - 1) / CLASS_QUANTUM];
+}
+
+static inline int _current_node(nkit_mempool_t* pool) {
+    int node = nkit_get_current_node();
+    // Fallback to node 0 if nkit_get_current_node fails or system is UMA
+    if (node < 0 || node >= pool->num_nodes) {
+        node = 0;
+    }
+    return node;
+}
+
+/**
+ * @brief Natural alignment of a size class: its largest power-of-two
+ *        divisor, clamped to [16, CLASS_MAX_ALIGN].
+ */
+static inline size_t _class_align(size_t size) {
+    size_t align = size & (~size + 1);
+    if (align < 16) align = 16;
+    if (align > CLASS_MAX_ALIGN) align = CLASS_MAX_ALIGN;
+    return align;
+}
+
+static inline nkit_slab_t* _slab_get(nkit_mempool_t* pool, int node, int sc) {
+    return atomic_load_explicit(&pool->nodes[node].slabs[sc], memory_order_acquire);
+}
+
+/**
+ * @brief Slab of class 'sc' on 'node', created on first use.
+ *
+ * Only classes that are actually used cost memory: a pool with dozens
+ * of classes maps nothing for the ones it never serves.
+ */
+static nkit_slab_t* _slab_get_or_create(nkit_mempool_t* pool, int node, int sc) {
+    nkit_slab_t* slab = _slab_get(pool, node, sc);
+    if (__builtin_expect(slab != NULL, 1)) return slab;
+
+    nkit_mempool_node_t* n = &pool->nodes[node];
+    pthread_mutex_lock(&n->slab_lock);
+    slab = atomic_load_explicit(&n->slabs[sc], memory_order_relaxed);
+    if (!slab) {
+        // Slots are exactly the class size at its natural alignment;
+        // the extents are tagged with the class for header-free lookup.
+        size_t size = pool->class_size[sc];
+        slab = _nkit_slab_create_tagged(node, size, _class_align(size),
+                                        EXTENT_CAPACITY_PER_SLAB,
+                                        MAX_EXTENTS_PER_SLAB,
+                                        (uint32_t)sc);
+        if (slab) {
+            atomic_store_explicit(&n->slabs[sc], slab, memory_order_release);
+        }
+    }
+    pthread_mutex_unlock(&n->slab_lock);
+    return slab;
+}
+
+/**
+ * @brief Return the 'n' oldest objects of a magazine to the tcache node's slab.
+ */
+static void _magazine_flush(nkit_mempool_tcache_t* tc, int sc, uint32_t n) {
+    nkit_magazine_t* mag = &tc->mags[sc];
+    if (n > mag->count) n = mag->count;
+    if (n == 0) return;
+
+    nkit_slab_free_bulk(_slab_get(tc->pool, tc->node, sc), mag->objs, n);
+
+    mag->count -= n;
+    memmove(&mag->objs[0], &mag->objs[n], mag->count * sizeof(void*));
+}
+
+// ---------------------------------------------------------------------------
+// Remote Frees
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Post the pending batch for 'node' to that node's inbox.
+ */
+static void _remote_post(nkit_mempool_tcache_t* tc, int node) {
+    nkit_remote_batch_t* batch = &tc->remote[node];
+    if (batch->count == 0) return;
+
+    nkit_mempool_t* pool = tc->pool;
+    _Atomic(void*)* inbox = &pool->nodes[node].inbox;
+
+    // Splice the whole private list in front of the inbox
+    void* old = atomic_load_explicit(inbox, memory_order_relaxed);
+    do {
+        *(void**)batch->tail = old;
+    } while (!atomic_compare_exchange_weak_explicit(inbox, &old, batch->head,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+
+    nkit_pcounter_add(pool->remote_frees, batch->count);
+
+    batch->head  = NULL;
+    batch->tail  = NULL;
+    batch->count = 0;
+}
+
+/**
+ * @brief Queue a block owned by another node; posts a full batch.
+ */
+static inline void _remote_free(nkit_mempool_tcache_t* tc, void* ptr, int node) {
+    nkit_remote_batch_t* batch = &tc->remote[node];
+
+    *(void**)ptr = batch->head;
+    if (!batch->head) batch->tail = ptr;
+    batch->head = ptr;
+
+    if (++batch->count == REMOTE_BATCH) {
+        _remote_post(tc, node);
+    }
+}
+
+/**
+ * @brief Take every block posted to this tcache's node.
+ *
+ * Blocks refill the matching magazines; whatever does not fit goes
+ * back to its owner slab (which is local to this node).
+ */
+static void _inbox_drain(nkit_mempool_tcache_t* tc) {
+    void* ptr = atomic_exchange_explicit(&tc->pool->nodes[tc->node].inbox, NULL,
+                                         memory_order_acquire);
+    while (ptr) {
+        void* next = *(void**)ptr;
+        const _nkit_page_owner_t* desc = _nkit_pagemap_get(ptr);
+
+        nkit_magazine_t* mag = &tc->mags[desc->tag];
+        if (mag->count < MAGAZINE_SIZE) {
+            mag->objs[mag->count++] = ptr;
+        } else {
+            nkit_slab_free((nkit_slab_t*)desc->owner, ptr);
+        }
+        ptr = next;
+    }
+}
+
+static void _tcache_flush_all(nkit_mempool_tcache_t* tc) {
+    for (int sc = 0; sc < tc->pool->num_classes; sc++) {
+        _magazine_flush(tc, sc, tc->mags[sc].count);
+    }
+    for (int node = 0; node < tc->pool->num_nodes; node++) {
+        _remote_post(tc, node);
+    }
+}
+
+static void _tcache_free_mem(nkit_mempool_tcache_t* tc) {
+    if (g_nkit_ctx.numa_supported) {
+        numa_free(tc, tc->pool->tcache_bytes);
+    } else {
+        free(tc);
+    }
+}
+
+/**
+ * @brief pthread key destructor: flush and unregister on thread exit.
+ *
+ * The slot is then parked on pool->retired. Later destructors (other
+ * keys, libc's own thread cleanup) may still allocate and free; they
+ * bypass the cache instead of building a new one nobody would flush.
+ */
+static void _tcache_destroy(void* arg) {
+    nkit_mempool_t* pool = *(nkit_mempool_t**)arg;
+
+    if (arg != (void*)&pool->retired) {
+        nkit_mempool_tcache_t* tc = (nkit_mempool_tcache_t*)arg;
+        _tcache_flush_all(tc);
+
+        pthread_mutex_lock(&pool->tcache_lock);
+        if (tc->prev) tc->prev->next = tc->next;
+        else          pool->tcaches  = tc->next;
+        if (tc->next) tc->next->prev = tc->prev;
+        pthread_mutex_unlock(&pool->tcache_lock);
+
+        _tcache_free_mem(tc);
+    }
+
+    // Cleared before each destructor round: park it again (the number of
+    // rounds is bounded by PTHREAD_DESTRUCTOR_ITERATIONS)
+    pthread_setspecific(pool->tcache_key, &pool->retired);
+}
+
+static nkit_mempool_tcache_t* _tcache_create(nkit_mempool_t* pool) {
+    int node = _current_node(pool);
+
+    nkit_mempool_tcache_t* tc;
+    if (g_nkit_ctx.numa_supported) {
+        // Keep the magazines on the thread's own node
+        tc = numa_alloc_onnode(pool->tcache_bytes, node);
+    } else {
+        tc = malloc(pool->tcache_bytes);
+    }
+    if (!tc) return NULL;
+
+    memset(tc, 0, pool->tcache_bytes);
+    tc->pool = pool;
+    tc->node = node;
+
+    if (pthread_setspecific(pool->tcache_key, tc) != 0) {
+        _tcache_free_mem(tc);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&pool->tcache_lock);
+    tc->next = pool->tcaches;
+    if (pool->tcaches) pool->tcaches->prev = tc;
+    pool->tcaches = tc;
+    pthread_mutex_unlock(&pool->tcache_lock);
+
+    return tc;
+}
+
+static inline nkit_mempool_tcache_t* _tcache_get(nkit_mempool_t* pool) {
+    void* tc = pthread_getspecific(pool->tcache_key);
+    if (__builtin_expect(tc != NULL && tc != (void*)&pool->retired, 1)) return tc;
+    if (tc) return NULL; // Thread is exiting
+    return _tcache_create(pool);
+}
+
+/**
+ * @brief Slow path: refill an empty magazine with a batch from the local slab.
+ *
+ * This is the only place the thread's node is re-checked. If the thread
+ * has moved, its magazines are returned to the old node first. Blocks
+ * other nodes have freed back to us are taken before touching the slab.
+ *
+ * @return Number of objects now in the magazine.
+ */
+static uint32_t _magazine_refill(nkit_mempool_tcache_t* tc, int sc) {
+    nkit_mempool_t* pool = tc->pool;
+
+    int node = _current_node(pool);
+    if (node != tc->node) {
+        _tcache_flush_all(tc);
+        tc->node = node;
+    }
+
+    nkit_magazine_t* mag = &tc->mags[sc];
+    if (atomic_load_explicit(&pool->nodes[node].inbox, memory_order_relaxed)) {
+        _inbox_drain(tc);
+        if (mag->count > 0) return mag->count;
+    }
+
+    nkit_slab_t* slab = _slab_get_or_create(pool, node, sc);
+    if (!slab) return mag->count;
+
+    size_t got = nkit_slab_alloc_bulk(slab, &mag->objs[mag->count], MAGAZINE_BATCH);
+    mag->count += (uint32_t)got;
+    return mag->count;
+}
+
+/**
+ * @brief Last resort when the local slab cannot grow any further: borrow
+ *        one object from another node. Remote objects are never cached.
+ */
+static void* _alloc_remote(nkit_mempool_t* pool, int local_node, int sc) {
+    // Fallback: Try other nodes (simple linear search for now)
+    for (int n = 0; n < pool->num_nodes; n++) {
+        if (n == local_node) continue;
+        void* block = nkit_slab_alloc(_slab_get_or_create(pool, n, sc));
+        if (block) {
+            _nkit_stat_add(_NKIT_STAT_REMOTE_FALLBACK, local_node, 1);
+            return block;
+        }
+    }
+    return NULL; // Completely exhausted across all nodes
+}
+
+// ---------------------------------------------------------------------------
+// Large Objects
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Return the body of a free span to the OS (descriptor page kept).
+ *
+ * Runs may be hugetlb-backed, where only whole huge pages can be dropped
+ * and a finer madvise fails with EINVAL. Start at the arena's page size
+ * and step up on EINVAL, since a growable arena may mix chunk backings.
+ */
+static void _large_purge(nkit_mempool_large_t* large, nkit_large_span_t* span) {
+    static const size_t grains[] = { LARGE_PAGE, 2UL * 1024 * 1024, 1024UL * 1024 * 1024 };
+    size_t first = nkit_arena_backing(large->runs) >= NKIT_PAGE_2M
+                 ? nkit_arena_page_size(large->runs) : LARGE_PAGE;
+
+    uintptr_t body = (uintptr_t)span + LARGE_PAGE;
+    uintptr_t end  = (uintptr_t)span + span->size;
+    for (size_t i = 0; i < sizeof(grains) / sizeof(grains[0]); i++) {
+        size_t grain = grains[i];
+        if (grain < first) continue;
+
+        uintptr_t lo = (body + grain - 1) & ~(uintptr_t)(grain - 1);
+        uintptr_t hi = end & ~(uintptr_t)(grain - 1);
+        if (hi <= lo) return; // No whole page of this size to drop
+        if (madvise((void*)lo, hi - lo, MADV_DONTNEED) == 0) return;
+        if (errno != EINVAL) return;
+    }
+}
+
+/**
+ * @brief Insert a span into an address-ordered free list, merging it
+ *        with adjacent spans of that list. Caller holds the lock and
+ *        accounts for the bytes.
+ * @return The (possibly merged) free span that now covers 'span'.
+ */
+static nkit_large_span_t* _large_insert(nkit_large_span_t** list,
+                                        nkit_large_span_t* span) {
+    nkit_large_span_t* prev = NULL;
+    nkit_large_span_t* next = *list;
+    while (next && next < span) {
+        prev = next;
+        next = next->next;
+    }
+
+    // Merge forward
+    if (next && (char*)span + span->size == (char*)next) {
+        span->size += next->size;
+        next = next->next;
+    }
+    span->next = next;
+
+    // Merge backward
+    if (prev && (char*)prev + prev->size == (char*)span) {
+        prev->size += span->size;
+        prev->next  = span->next;
+        return prev;
+    }
+
+    if (prev) prev->next = span;
+    else      *list = span;
+    return span;
+}
+
+/**
+ * @brief Drop the pages of a warm free span and move it to the cold list.
+ */
+static void _large_cool(nkit_mempool_large_t* large, nkit_large_span_t* span) {
+    nkit_large_span_t** link = &large->free;
+    while (*link != span) link = &(*link)->next;
+    *link = span->next;
+    large->cached -= span->size;
+
+    _large_purge(large, span);
+    large->purged += span->size;
+    _large_insert(&large->cold, span);
+}
+
+/**
+ * @brief Return a span to the warm list (caller holds the lock).
+ *
+ * If that overflows the cache, the merged span keeps its place for reuse
+ * but drops its pages. The cache was within bounds before, so this
+ * brings it back under.
+ */
+static void _large_cache(nkit_mempool_large_t* large, nkit_large_span_t* span) {
+    large->cached += span->size;
+    nkit_large_span_t* merged = _large_insert(&large->free, span);
+    if (large->cached > LARGE_CACHE_MAX) {
+        _large_cool(large, merged);
+    }
+}
+
+/**
+ * @brief First fit of 'need' bytes in one free list, split from the tail
+ *        so the list link stays in place. Caller holds the lock.
+ */
+static nkit_large_span_t* _large_fit(nkit_large_span_t** list, size_t* bytes, size_t need) {
+    nkit_large_span_t** link = list;
+    for (nkit_large_span_t* f = *list; f; link = &f->next, f = f->next) {
+        if (f->size < need) continue;
+
+        *bytes -= need;
+        if (f->size == need) {
+            *link = f->next;
+            return f;
+        }
+        f->size -= need;
+        return (nkit_large_span_t*)((char*)f + f->size);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Take a span of exactly 'need' bytes from one node.
+ */
+static nkit_large_span_t* _large_take(nkit_mempool_large_t* large, int node, size_t need) {
+    nkit_large_span_t* span = NULL;
+
+    pthread_mutex_lock(&large->lock);
+
+    // 1. First fit among free spans, warm ones (pages still mapped) first
+    span = _large_fit(&large->free, &large->cached, need);
+    if (!span) span = _large_fit(&large->cold, &large->purged, need);
+
+    // 2. Carve a new run; the remainder goes to the cache
+    if (!span) {
+        if (!large->runs) {
+            large->runs = nkit_arena_create_growable(node, LARGE_RUN_SIZE);
+        }
+
+        size_t run = (need + LARGE_RUN_SIZE - 1) & ~(LARGE_RUN_SIZE - 1);
+        if (large->runs) {
+            // A run that does not fit makes the arena map a new chunk and
+            // abandon the rest of this one: cache that tail first. Every
+            // carve is whole pages and the arena never rewinds, so the
+            // unused bytes are exactly the current chunk's tail.
+            size_t left = nkit_arena_size(large->runs) - nkit_arena_used(large->runs);
+            if (left >= LARGE_PAGE && left < run) {
+                nkit_large_span_t* tail = nkit_arena_alloc(large->runs, left);
+                if (tail) {
+                    tail->size = left;
+                    _large_cache(large, tail);
+                }
+            }
+            span = nkit_arena_alloc(large->runs, run);
+        }
+
+        if (span && run > need) {
+            nkit_large_span_t* rest = (nkit_large_span_t*)((char*)span + need);
+            rest->size = run - need;
+            _large_cache(large, rest);
+        }
+    }
+
+    pthread_mutex_unlock(&large->lock);
+
+    if (span) {
+        span->desc.owner = span;
+        span->desc.tag   = LARGE_SIZE_CLASS;
+        span->desc.node  = node;
+        span->size = need;
+        span->next = NULL;
+    }
+    return span;
+}
+
+/**
+ * @brief Large block whose user pointer sits 'offset' bytes into its span.
+ *
+ * 'offset' is LARGE_PREFIX, or a larger alignment; it must stay inside
+ * the descriptor page so the page map still resolves the pointer.
+ */
+static void* _large_alloc(nkit_mempool_t* pool, size_t size, size_t offset) {
+    if (size > SIZE_MAX - offset - LARGE_PAGE) return NULL;
+    size_t need = (size + offset + LARGE_PAGE - 1) & ~(LARGE_PAGE - 1);
+
+    // Local node first, then the others in order
+    int local = _current_node(pool);
+    for (int i = 0; i < pool->num_nodes; i++) {
+        int node = (local + i) % pool->num_nodes;
+        nkit_mempool_large_t* large = &pool->nodes[node].large;
+        nkit_large_span_t* span = _large_take(large, node, need);
+        if (!span) continue;
+
+        if (_nkit_pagemap_set(span, LARGE_PAGE, &span->desc) != 0) {
+            pthread_mutex_lock(&large->lock);
+            _large_cache(large, span);
+            pthread_mutex_unlock(&large->lock);
+            return NULL;
+        }
+
+        _nkit_stat_add(_NKIT_STAT_IN_USE, node, (int64_t)need);
+        if (i > 0) _nkit_stat_add(_NKIT_STAT_REMOTE_FALLBACK, local, 1);
+        return (char*)span + offset;
+    }
+    return NULL;
+}
+
+static void _large_free(nkit_mempool_t* pool, nkit_large_span_t* span) {
+    nkit_mempool_large_t* large = &pool->nodes[span->desc.node].large;
+    _nkit_pagemap_set(span, LARGE_PAGE, NULL);
+    _nkit_stat_add(_NKIT_STAT_IN_USE, span->desc.node, -(int64_t)span->size);
+
+    pthread_mutex_lock(&large->lock);
+    _large_cache(large, span);
+    pthread_mutex_unlock(&large->lock);
+}
+
+/**
+ * @brief Allocate one block of class 'sc_idx' (thread cache first).
+ */
+static inline void* _small_alloc(nkit_mempool_t* pool, int sc_idx) {
+    nkit_mempool_tcache_t* tc = _tcache_get(pool);
+    if (!tc) {
+        // No thread cache (out of memory, or thread exit): serve straight from the slabs
+        int node = _current_node(pool);
+        void* block = nkit_slab_alloc(_slab_get_or_create(pool, node, sc_idx));
+        if (block) return block;
+        return _alloc_remote(pool, node, sc_idx);
+    }
+
+    // Fast path: pop from the thread-local magazine
+    nkit_magazine_t* mag = &tc->mags[sc_idx];
+    if (__builtin_expect(mag->count == 0, 0)) {
+        if (_magazine_refill(tc, sc_idx) == 0) {
+            // Local slab exhausted
+            return _alloc_remote(pool, tc->node, sc_idx);
+        }
+    }
+
+    return mag->objs[--mag->count];
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Common constructor. 'classes' == NULL selects the default set.
+ */
+static nkit_mempool_t* _mempool_create(const size_t* classes, size_t num_classes) {
     if (!g_nkit_ctx.initialized) {
         // Assume library is initialized, or we return NULL
         return NULL;
     }
 
-    nkit_mempool_t* pool = malloc(sizeof(nkit_mempool_t));
+    nkit_mempool_t* pool = aligned_alloc(64, sizeof(nkit_mempool_t));
     if (!pool) return NULL;
 
     memset(pool, 0, sizeof(nkit_mempool_t));
@@ -66,96 +747,283 @@ nkit_mempool_t* nkit_mempool_create(void) {
         pool->num_nodes = MAX_NODES; // Bound check
     }
 
-    for (int node = 0; node < pool->num_nodes; node++) {
-        pool->nodes[node].logical_node_id = node;
-        for (int sc = 0; sc < NUM_SIZE_CLASSES; sc++) {
-            // Need enough capacity for the header + user size
-            size_t total_obj_size = sizeof(nkit_mempool_header_t) + SIZE_CLASSES[sc];
-            
-            // Slabs align elements to 64 bytes by default, but let's ensure
-            // the total size accommodates the user data correctly.
-            pool->nodes[node].slabs[sc] = nkit_slab_create(node, total_obj_size, INITIAL_CAPACITY_PER_SLAB);
-            if (!pool->nodes[node].slabs[sc]) {
-                // Cleanup on partial failure
-                nkit_mempool_destroy(pool);
+    // 1. Size classes and their lookup table
+    if (!classes) {
+        pool->num_classes = NUM_DEFAULT_CLASSES;
+        pool->class_size  = DEFAULT_CLASSES;
+        pool->class_of    = DEFAULT_CLASS_OF;
+    } else {
+        size_t prev = 0;
+        for (size_t i = 0; i < num_classes; i++) {
+            // Rounded to the lookup quantum; must stay strictly increasing
+            size_t size = (classes[i] + CLASS_QUANTUM - 1) & ~(size_t)(CLASS_QUANTUM - 1);
+            if (size == 0 || size <= prev || size > NKIT_MEMPOOL_MAX_SMALL) {
+                free(pool);
                 return NULL;
             }
+            pool->custom_class_size[i] = size;
+            prev = size;
+        }
+
+        // Every 16-byte step maps to the first class that can hold it;
+        // steps past the largest class are never looked up.
+        size_t sc = 0;
+        for (size_t i = 0; i < CLASS_LOOKUP_ENTRIES; i++) {
+            while (sc < num_classes - 1 && i * CLASS_QUANTUM > pool->custom_class_size[sc]) {
+                sc++;
+            }
+            pool->custom_class_of[i] = (uint8_t)sc;
         }
+
+        pool->num_classes = (int)num_classes;
+        pool->class_size  = pool->custom_class_size;
+        pool->class_of    = pool->custom_class_of;
+    }
+    pool->max_small    = pool->class_size[pool->num_classes - 1];
+    pool->tcache_bytes = sizeof(nkit_mempool_tcache_t) +
+                         (size_t)pool->num_classes * sizeof(nkit_magazine_t);
+
+    // 2. Shared state
+    pool->remote_frees = nkit_pcounter_create();
+    if (!pool->remote_frees) {
+        free(pool);
+        return NULL;
+    }
+
+    if (pthread_key_create(&pool->tcache_key, _tcache_destroy) != 0) {
+        nkit_pcounter_destroy(pool->remote_frees);
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->tcache_lock, NULL);
+    pool->retired.pool = pool;
+
+    // 3. Per-node state; slabs are created on first use of each class
+    for (int node = 0; node < pool->num_nodes; node++) {
+        pool->nodes[node].logical_node_id = node;
+        pthread_mutex_init(&pool->nodes[node].slab_lock, NULL);
+        pthread_mutex_init(&pool->nodes[node].large.lock, NULL);
     }
 
     return pool;
 }
 
+nkit_mempool_t* nkit_mempool_create(void) {
+    return _mempool_create(NULL, 0);
+}
+
+nkit_mempool_t* nkit_mempool_create_ex(const size_t* class_sizes, size_t num_classes) {
+    if (!class_sizes || num_classes == 0 || num_classes > NKIT_MEMPOOL_MAX_CLASSES) {
+        return NULL;
+    }
+    return _mempool_create(class_sizes, num_classes);
+}
+
 void* nkit_mempool_alloc(nkit_mempool_t* pool, size_t size) {
     if (!pool || size == 0) return NULL;
 
-    // Reject allocations larger than our biggest size class
-    if (size > SIZE_CLASSES[NUM_SIZE_CLASSES - 1]) return NULL;
+    // Beyond the biggest size class: page-granular large tier
+    if (size > pool->max_small) return _large_alloc(pool, size, LARGE_PREFIX);
 
-    int current_node = nkit_get_current_node();
-    // Fallback to node 0 if nkit_get_current_node fails or system is UMA
-    if (current_node < 0 || current_node >= pool->num_nodes) {
-        current_node = 0;
-    }
+    // Find the appropriate size class (one table load)
+    return _small_alloc(pool, _size_class(pool, size));
+}
 
-    // Find the appropriate size class
-    int sc_idx = -1;
-    for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
-        if (size <= SIZE_CLASSES[i]) {
-            sc_idx = i;
-            break;
+void* nkit_mempool_alloc_aligned(nkit_mempool_t* pool, size_t size, size_t align) {
+    if (!pool || size == 0 || align == 0 || (align & (align - 1)) != 0) return NULL;
+    if (align > LARGE_PAGE / 2) return NULL;
+
+    // Small: the first class at least this big whose natural alignment is
+    // enough (e.g. 128B for aligned_alloc(128, 32)); large only without one
+    if (size <= pool->max_small) {
+        for (int sc = _size_class(pool, size); sc < pool->num_classes; sc++) {
+            if (_class_align(pool->class_size[sc]) >= align) {
+                return _small_alloc(pool, sc);
+            }
         }
     }
 
-    if (sc_idx == -1) return NULL; // Should be handled by size check above
+    // Large: spans are page aligned, so start the block 'align' bytes in
+    return _large_alloc(pool, size, align > LARGE_PREFIX ? align : LARGE_PREFIX);
+}
+
+void nkit_mempool_free(nkit_mempool_t* pool, void* ptr) {
+    if (!pool || !ptr) return;
+
+    // Owner, size class and home node come from the page map
+    const _nkit_page_owner_t* desc = _nkit_pagemap_get(ptr);
+    if (!desc) return; // Not ours
+    if (desc->tag == LARGE_SIZE_CLASS) {
+        _large_free(pool, (nkit_large_span_t*)desc->owner);
+        return;
+    }
+
+    nkit_mempool_tcache_t* tc = _tcache_get(pool);
+    if (!tc) {
+        // No thread cache (out of memory, or thread exit): give it back to the original slab
+        nkit_slab_free((nkit_slab_t*)desc->owner, ptr);
+        return;
+    }
+    if (desc->node != tc->node) {
+        // Owned by another node: batch it for that node's inbox
+        _remote_free(tc, ptr, desc->node);
+        return;
+    }
+
+    // Fast path: push onto the thread-local magazine, spilling a batch if full
+    nkit_magazine_t* mag = &tc->mags[desc->tag];
+    if (__builtin_expect(mag->count == MAGAZINE_SIZE, 0)) {
+        _magazine_flush(tc, (int)desc->tag, MAGAZINE_BATCH);
+    }
+    mag->objs[mag->count++] = ptr;
+}
+
+void nkit_mempool_flush(nkit_mempool_t* pool) {
+    if (!pool) return;
+
+    void* tc = pthread_getspecific(pool->tcache_key);
+    if (tc && tc != (void*)&pool->retired) {
+        _tcache_flush_all(tc);
+    }
+}
+
+size_t nkit_mempool_trim(nkit_mempool_t* pool) {
+    if (!pool) return 0;
+
+    // Cached objects keep extents busy: hand ours back first
+    nkit_mempool_flush(pool);
+
+    size_t released = 0;
+    for (int node = 0; node < pool->num_nodes; node++) {
+        // So do blocks parked in the inbox
+        void* ptr = atomic_exchange_explicit(&pool->nodes[node].inbox, NULL,
+                                             memory_order_acquire);
+        while (ptr) {
+            void* next = *(void**)ptr;
+            nkit_slab_free((nkit_slab_t*)_nkit_pagemap_get(ptr)->owner, ptr);
+            ptr = next;
+        }
 
-    // Attempt allocation from local node's slab
-    nkit_slab_t* target_slab = pool->nodes[current_node].slabs[sc_idx];
-    void* raw_block = nkit_slab_alloc(target_slab);
+        for (int sc = 0; sc < pool->num_classes; sc++) {
+            released += nkit_slab_shrink(_slab_get(pool, node, sc));
+        }
 
-    // [FUTURE] If raw_block is NULL (slab exhausted), we could try borrowing
-    // from a neighboring NUMA node or allocating a new larger slab.
-    if (!raw_block) {
-        // Fallback: Try other nodes (simple linear search for now)
-        for(int n = 0; n < pool->num_nodes; n++) {
-            if (n == current_node) continue;
-             target_slab = pool->nodes[n].slabs[sc_idx];
-             raw_block = nkit_slab_alloc(target_slab);
-             if (raw_block) break;
+        // Cached large spans stay reusable but lose their pages
+        nkit_mempool_large_t* large = &pool->nodes[node].large;
+        pthread_mutex_lock(&large->lock);
+        while (large->free) {
+            _large_cool(large, large->free);
         }
+        pthread_mutex_unlock(&large->lock);
     }
+    return released;
+}
 
-    if (!raw_block) return NULL; // Completely exhausted across all nodes
+size_t nkit_mempool_usable_size(nkit_mempool_t* pool, const void* ptr) {
+    if (!pool || !ptr) return 0;
 
-    // Write header
-    nkit_mempool_header_t* header = (nkit_mempool_header_t*)raw_block;
-    header->owner_slab = target_slab;
+    const _nkit_page_owner_t* desc = _nkit_pagemap_get(ptr);
+    if (!desc) return 0;
+    if (desc->tag == LARGE_SIZE_CLASS) {
+        nkit_large_span_t* span = (nkit_large_span_t*)desc->owner;
+        return (size_t)((const char*)span + span->size - (const char*)ptr);
+    }
 
-    // Return pointer to user data (just after the header)
-    return (void*)(header + 1);
+    // Slab pages of other pools or plain slabs are not ours
+    if (desc->node < 0 || desc->node >= pool->num_nodes ||
+        desc->tag >= (uint32_t)pool->num_classes ||
+        desc->owner != _slab_get(pool, desc->node, (int)desc->tag)) {
+        return 0;
+    }
+    return pool->class_size[desc->tag];
 }
 
-void nkit_mempool_free(nkit_mempool_t* pool, void* ptr) {
-    if (!pool || !ptr) return;
+size_t nkit_mempool_class_size(nkit_mempool_t* pool, size_t size) {
+    if (!pool || size == 0) return 0;
+    if (size > pool->max_small) {
+        if (size > SIZE_MAX - LARGE_PREFIX - LARGE_PAGE) return 0;
+        return ((size + LARGE_PREFIX + LARGE_PAGE - 1) & ~(LARGE_PAGE - 1)) - LARGE_PREFIX;
+    }
+    return pool->class_size[_size_class(pool, size)];
+}
+
+uint64_t nkit_mempool_remote_frees(nkit_mempool_t* pool) {
+    if (!pool) return 0;
+    return (uint64_t)nkit_pcounter_read(pool->remote_frees);
+}
+
+// ---------------------------------------------------------------------------
+// Fork Support
+// ---------------------------------------------------------------------------
+
+void nkit_mempool_prefork(nkit_mempool_t* pool) {
+    if (!pool) return;
+
+    // Outer locks first, in the order the alloc paths nest them
+    pthread_mutex_lock(&pool->tcache_lock);
+    for (int node = 0; node < pool->num_nodes; node++) {
+        pthread_mutex_lock(&pool->nodes[node].slab_lock);
+        pthread_mutex_lock(&pool->nodes[node].large.lock);
+    }
+    _nkit_slab_prefork();
+}
+
+void nkit_mempool_postfork_parent(nkit_mempool_t* pool) {
+    if (!pool) return;
 
-    // Pointer arithmetic to strictly get the header
-    nkit_mempool_header_t* header = ((nkit_mempool_header_t*)ptr) - 1;
+    _nkit_slab_postfork_parent();
+    for (int node = pool->num_nodes; node-- > 0;) {
+        pthread_mutex_unlock(&pool->nodes[node].large.lock);
+        pthread_mutex_unlock(&pool->nodes[node].slab_lock);
+    }
+    pthread_mutex_unlock(&pool->tcache_lock);
+}
+
+void nkit_mempool_postfork_child(nkit_mempool_t* pool) {
+    if (!pool) return;
 
-    // Give it back to the original slab
-    if (header->owner_slab) {
-         nkit_slab_free(header->owner_slab, (void*)header);
+    // Only the forking thread survives: start every lock over. Tcaches of
+    // the vanished threads stay registered and are freed with the pool.
+    _nkit_slab_postfork_child();
+    for (int node = 0; node < pool->num_nodes; node++) {
+        pthread_mutex_init(&pool->nodes[node].large.lock, NULL);
+        pthread_mutex_init(&pool->nodes[node].slab_lock, NULL);
     }
+    pthread_mutex_init(&pool->tcache_lock, NULL);
 }
 
 void nkit_mempool_destroy(nkit_mempool_t* pool) {
     if (!pool) return;
 
+    // Stop thread-exit destructors from touching this pool, then drop
+    // every remaining tcache (the slabs below own all cached objects).
+    pthread_key_delete(pool->tcache_key);
+    nkit_mempool_tcache_t* tc = pool->tcaches;
+    while (tc) {
+        nkit_mempool_tcache_t* next = tc->next;
+        _tcache_free_mem(tc);
+        tc = next;
+    }
+    pthread_mutex_destroy(&pool->tcache_lock);
+    nkit_pcounter_destroy(pool->remote_frees);
+
     for (int node = 0; node < pool->num_nodes; node++) {
-        for (int sc = 0; sc < NUM_SIZE_CLASSES; sc++) {
-            if (pool->nodes[node].slabs[sc]) {
-                nkit_slab_destroy(pool->nodes[node].slabs[sc]);
+        for (int sc = 0; sc < pool->num_classes; sc++) {
+            nkit_slab_t* slab = _slab_get(pool, node, sc);
+            if (slab) {
+                nkit_slab_destroy(slab);
             }
         }
+        // Large blocks still out die with their runs: drop them from telemetry
+        nkit_mempool_large_t* large = &pool->nodes[node].large;
+        size_t carved = nkit_arena_used(large->runs);
+        size_t idle = large->cached + large->purged;
+        if (carved > idle) {
+            _nkit_stat_add(_NKIT_STAT_IN_USE, node, -(int64_t)(carved - idle));
+        }
+        nkit_arena_destroy(large->runs);
+        pthread_mutex_destroy(&pool->nodes[node].large.lock);
+        pthread_mutex_destroy(&pool->nodes[node].slab_lock);
     }
 
     free(pool);
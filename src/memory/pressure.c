@@ -0,0 +1,319 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <numakit/memory.h>
+#include <numakit/topology.h>
+#include "../internal.h"
+
+// ---------------------------------------------------------------------------
+// Configuration
+// ---------------------------------------------------------------------------
+#define PRESSURE_MAX_NODES       64
+#define PRESSURE_DEFAULT_LOW     10.0  // % of the node free
+#define PRESSURE_DEFAULT_CRIT    3.0
+#define PRESSURE_DEFAULT_PERIOD  100   // ms
+#define PRESSURE_HYSTERESIS      1.25  // Leave a level 25% above its threshold
+
+typedef enum {
+    HOOK_CALLBACK,
+    HOOK_ARENA,
+    HOOK_SLAB,
+    HOOK_MEMPOOL
+} nkit_pressure_hook_kind_t;
+
+typedef struct nkit_pressure_hook_s {
+    struct nkit_pressure_hook_s* next;
+    nkit_pressure_hook_kind_t    kind;
+    void*                        obj;   // Watched allocator (HOOK_CALLBACK: NULL)
+    nkit_pressure_cb_t           cb;
+    void*                        arg;
+} nkit_pressure_hook_t;
+
+struct nkit_pressure_s {
+    nkit_pressure_attr_t  attr;
+    int                   num_nodes;
+    pthread_t             thread;
+    pthread_mutex_t       lock;    // Serializes samples, hooks and 'stop'
+    pthread_cond_t        cond;    // Wakes the worker early on destroy
+    int                   stop;
+    nkit_pressure_hook_t* hooks;
+};
+
+// Published levels, read without locks by arenas and nkit_pressure_level()
+static atomic_int  g_pressure_levels[PRESSURE_MAX_NODES];
+static atomic_bool g_pressure_running;
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static nkit_pressure_level_t _pressure_classify(const nkit_pressure_t* mon,
+                                                nkit_pressure_level_t prev,
+                                                size_t total, size_t free_bytes) {
+    double pct  = total ? 100.0 * (double)free_bytes / (double)total : 100.0;
+    double crit = mon->attr.critical_free_pct;
+    double low  = mon->attr.low_free_pct;
+
+    // Enter a level below its threshold, leave it only clearly above it
+    if (crit >= 0 && pct < crit * (prev >= NKIT_PRESSURE_CRITICAL ? PRESSURE_HYSTERESIS : 1.0)) {
+        return NKIT_PRESSURE_CRITICAL;
+    }
+    if (pct < low * (prev >= NKIT_PRESSURE_LOW ? PRESSURE_HYSTERESIS : 1.0)) {
+        return NKIT_PRESSURE_LOW;
+    }
+    return NKIT_PRESSURE_NONE;
+}
+
+/**
+ * @brief Deliver a level change: callbacks always, reclaim when it got worse.
+ */
+static void _pressure_notify(nkit_pressure_t* mon, int node,
+                             nkit_pressure_level_t prev, nkit_pressure_level_t level) {
+    for (nkit_pressure_hook_t* h = mon->hooks; h; h = h->next) {
+        if (h->kind == HOOK_CALLBACK) {
+            h->cb(node, level, h->arg);
+            continue;
+        }
+        if (level <= prev) continue;
+
+        switch (h->kind) {
+            case HOOK_ARENA:
+                if (_nkit_arena_node(h->obj) == node) {
+                    nkit_arena_trim(h->obj);
+                    nkit_arena_coalesce(h->obj);
+                }
+                break;
+            case HOOK_SLAB:
+                if (_nkit_slab_node(h->obj) == node) {
+                    nkit_slab_shrink(h->obj);
+                }
+                break;
+            case HOOK_MEMPOOL:
+                nkit_mempool_trim(h->obj);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Sample every node once (mon->lock held).
+ * @return Number of nodes whose level changed.
+ */
+static int _pressure_sample(nkit_pressure_t* mon) {
+    int changed = 0;
+    for (int node = 0; node < mon->num_nodes; node++) {
+        size_t total = 0, free_bytes = 0;
+        if (nkit_topo_node_memory(node, &total, &free_bytes) != 0) continue;
+
+        nkit_pressure_level_t prev = atomic_load(&g_pressure_levels[node]);
+        nkit_pressure_level_t level = _pressure_classify(mon, prev, total, free_bytes);
+        if (level == prev) continue;
+
+        atomic_store(&g_pressure_levels[node], level);
+        _pressure_notify(mon, node, prev, level);
+        changed++;
+    }
+    return changed;
+}
+
+static void* _pressure_worker(void* arg) {
+    nkit_pressure_t* mon = arg;
+
+    pthread_mutex_lock(&mon->lock);
+    while (!mon->stop) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec  += mon->attr.interval_ms / 1000;
+        deadline.tv_nsec += (long)(mon->attr.interval_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        while (!mon->stop &&
+               pthread_cond_timedwait(&mon->cond, &mon->lock, &deadline) != ETIMEDOUT) {
+        }
+        if (!mon->stop) _pressure_sample(mon);
+    }
+    pthread_mutex_unlock(&mon->lock);
+    return NULL;
+}
+
+static int _pressure_add_hook(nkit_pressure_t* mon, nkit_pressure_hook_kind_t kind,
+                              void* obj, nkit_pressure_cb_t cb, void* arg) {
+    nkit_pressure_hook_t* h = malloc(sizeof(nkit_pressure_hook_t));
+    if (!h) return -1;
+
+    h->kind = kind;
+    h->obj  = obj;
+    h->cb   = cb;
+    h->arg  = arg;
+
+    pthread_mutex_lock(&mon->lock);
+    h->next = mon->hooks;
+    mon->hooks = h;
+    pthread_mutex_unlock(&mon->lock);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Internal API
+// ---------------------------------------------------------------------------
+
+int _nkit_pressure_spill_node(int node) {
+    if (!atomic_load_explicit(&g_pressure_running, memory_order_relaxed)) return node;
+    if (node < 0 || node >= PRESSURE_MAX_NODES) return node;
+
+    int level = atomic_load_explicit(&g_pressure_levels[node], memory_order_relaxed);
+    if (level == NKIT_PRESSURE_NONE) return node;
+
+    // Nearest node under less pressure; ties go to the calmer one
+    int best = node, best_level = level, best_dist = 0;
+    int num_nodes = g_nkit_ctx.num_nodes < PRESSURE_MAX_NODES
+                  ? g_nkit_ctx.num_nodes : PRESSURE_MAX_NODES;
+    for (int n = 0; n < num_nodes; n++) {
+        int l = atomic_load_explicit(&g_pressure_levels[n], memory_order_relaxed);
+        if (n == node || l >= level) continue;
+
+        int dist = nkit_topo_distance(node, n);
+        if (dist < 0) continue;
+        if (best == node || dist < best_dist || (dist == best_dist && l < best_level)) {
+            best = n;
+            best_level = l;
+            best_dist = dist;
+        }
+    }
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+nkit_pressure_t* nkit_pressure_create(const nkit_pressure_attr_t* attr) {
+    if (!g_nkit_ctx.initialized) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&g_pressure_running, &expected, true)) {
+        errno = EBUSY;
+        return NULL;
+    }
+
+    nkit_pressure_t* mon = calloc(1, sizeof(nkit_pressure_t));
+    if (!mon) goto fail;
+
+    if (attr) mon->attr = *attr;
+    if (mon->attr.low_free_pct == 0) mon->attr.low_free_pct = PRESSURE_DEFAULT_LOW;
+    if (mon->attr.critical_free_pct == 0) mon->attr.critical_free_pct = PRESSURE_DEFAULT_CRIT;
+    if (mon->attr.interval_ms == 0) mon->attr.interval_ms = PRESSURE_DEFAULT_PERIOD;
+
+    mon->num_nodes = g_nkit_ctx.num_nodes < PRESSURE_MAX_NODES
+                   ? g_nkit_ctx.num_nodes : PRESSURE_MAX_NODES;
+
+    pthread_condattr_t cattr;
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&mon->cond, &cattr);
+    pthread_condattr_destroy(&cattr);
+    pthread_mutex_init(&mon->lock, NULL);
+
+    if (pthread_create(&mon->thread, NULL, _pressure_worker, mon) != 0) {
+        pthread_cond_destroy(&mon->cond);
+        pthread_mutex_destroy(&mon->lock);
+        free(mon);
+        goto fail;
+    }
+    return mon;
+
+fail:
+    atomic_store(&g_pressure_running, false);
+    return NULL;
+}
+
+int nkit_pressure_on_change(nkit_pressure_t* mon, nkit_pressure_cb_t cb, void* arg) {
+    if (!mon || !cb) return -1;
+    return _pressure_add_hook(mon, HOOK_CALLBACK, NULL, cb, arg);
+}
+
+int nkit_pressure_watch_arena(nkit_pressure_t* mon, nkit_arena_t* arena) {
+    if (!mon || !arena) return -1;
+    return _pressure_add_hook(mon, HOOK_ARENA, arena, NULL, NULL);
+}
+
+int nkit_pressure_watch_slab(nkit_pressure_t* mon, nkit_slab_t* slab) {
+    if (!mon || !slab) return -1;
+    return _pressure_add_hook(mon, HOOK_SLAB, slab, NULL, NULL);
+}
+
+int nkit_pressure_watch_mempool(nkit_pressure_t* mon, nkit_mempool_t* pool) {
+    if (!mon || !pool) return -1;
+    return _pressure_add_hook(mon, HOOK_MEMPOOL, pool, NULL, NULL);
+}
+
+int nkit_pressure_unwatch(nkit_pressure_t* mon, const void* obj) {
+    if (!mon || !obj) return -1;
+
+    // Taking the lock also waits out a reclaim pass in progress
+    pthread_mutex_lock(&mon->lock);
+    nkit_pressure_hook_t** link = &mon->hooks;
+    while (*link && (*link)->obj != obj) {
+        link = &(*link)->next;
+    }
+    nkit_pressure_hook_t* h = *link;
+    if (h) *link = h->next;
+    pthread_mutex_unlock(&mon->lock);
+
+    free(h);
+    return h ? 0 : -1;
+}
+
+int nkit_pressure_poll(nkit_pressure_t* mon) {
+    if (!mon) return -1;
+
+    pthread_mutex_lock(&mon->lock);
+    int changed = _pressure_sample(mon);
+    pthread_mutex_unlock(&mon->lock);
+    return changed;
+}
+
+nkit_pressure_level_t nkit_pressure_level(int node) {
+    if (node < 0 || node >= PRESSURE_MAX_NODES) return NKIT_PRESSURE_NONE;
+    return (nkit_pressure_level_t)atomic_load_explicit(&g_pressure_levels[node],
+                                                       memory_order_relaxed);
+}
+
+void nkit_pressure_destroy(nkit_pressure_t* mon) {
+    if (!mon) return;
+
+    pthread_mutex_lock(&mon->lock);
+    mon->stop = 1;
+    pthread_cond_signal(&mon->cond);
+    pthread_mutex_unlock(&mon->lock);
+    pthread_join(mon->thread, NULL);
+
+    for (int node = 0; node < PRESSURE_MAX_NODES; node++) {
+        atomic_store(&g_pressure_levels[node], NKIT_PRESSURE_NONE);
+    }
+
+    nkit_pressure_hook_t* h = mon->hooks;
+    while (h) {
+        nkit_pressure_hook_t* next = h->next;
+        free(h);
+        h = next;
+    }
+    pthread_cond_destroy(&mon->cond);
+    pthread_mutex_destroy(&mon->lock);
+    free(mon);
+    atomic_store(&g_pressure_running, false);
+}
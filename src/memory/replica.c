@@ -0,0 +1,224 @@
+#define _GNU_SOURCE
+
+#include <numakit/memory.h>
+#include <numakit/sched.h>
+#include "../internal.h"
+
+#include <numa.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Per-node reader counters, one per grace-period parity.
+ * Padded so readers on different nodes never share a cache line.
+ */
+typedef struct {
+    alignas(64) atomic_long readers[2];
+} nkit_replica_slot_t;
+
+/**
+ * @brief One published version: a private copy on every node.
+ */
+typedef struct {
+    size_t        size;
+    uint64_t      version;
+    nkit_arena_t* arenas[];   // num_nodes entries, followed by the data pointers
+} nkit_replica_set_t;
+
+struct nkit_replica_s {
+    _Atomic(nkit_replica_set_t*) current;
+    atomic_uint                  parity;    // Bumped by every publish
+    int                          num_nodes; // Snapshot of g_nkit_ctx.num_nodes
+    nkit_replica_slot_t**        slots;     // Per-node reader counters
+    pthread_mutex_t              publish_lock;
+};
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static inline const void** _set_data(const nkit_replica_t* rep, nkit_replica_set_t* set) {
+    return (const void**)&set->arenas[rep->num_nodes];
+}
+
+static void _set_free(const nkit_replica_t* rep, nkit_replica_set_t* set) {
+    if (!set) return;
+    for (int i = 0; i < rep->num_nodes; i++) {
+        nkit_arena_destroy(set->arenas[i]);
+    }
+    free(set);
+}
+
+/**
+ * @brief Copy 'data' into a fresh node-bound arena on every node.
+ */
+static nkit_replica_set_t* _set_build(const nkit_replica_t* rep, const void* data,
+                                      size_t size, uint64_t version) {
+    nkit_replica_set_t* set = calloc(1, sizeof(nkit_replica_set_t) +
+                                        rep->num_nodes * (sizeof(nkit_arena_t*) + sizeof(void*)));
+    if (!set) return NULL;
+
+    set->size = size;
+    set->version = version;
+    const void** replicas = _set_data(rep, set);
+
+    for (int i = 0; i < rep->num_nodes; i++) {
+        set->arenas[i] = nkit_arena_create(i, size);
+        void* copy = nkit_arena_alloc(set->arenas[i], size);
+        if (!copy) {
+            _set_free(rep, set);
+            return NULL;
+        }
+        // The arena is bound to node i, so these first touches land there
+        memcpy(copy, data, size);
+        replicas[i] = copy;
+    }
+    return set;
+}
+
+/**
+ * @brief Spin (yielding) until no reader is counted on 'parity'.
+ */
+static void _wait_readers(const nkit_replica_t* rep, unsigned parity) {
+    for (;;) {
+        long readers = 0;
+        for (int i = 0; i < rep->num_nodes; i++) {
+            readers += atomic_load(&rep->slots[i]->readers[parity]);
+        }
+        if (readers == 0) return;
+        sched_yield();
+    }
+}
+
+static void _slot_free(nkit_replica_slot_t* slot) {
+    if (g_nkit_ctx.numa_supported) {
+        numa_free(slot, sizeof(nkit_replica_slot_t));
+    } else {
+        free(slot);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+nkit_replica_t* nkit_replica_create(const void* data, size_t size) {
+    if (!data || size == 0) return NULL;
+
+    int num_nodes = g_nkit_ctx.num_nodes;
+    if (num_nodes <= 0) num_nodes = 1;
+
+    nkit_replica_t* rep = calloc(1, sizeof(nkit_replica_t));
+    if (!rep) return NULL;
+
+    rep->num_nodes = num_nodes;
+    rep->slots = calloc(num_nodes, sizeof(nkit_replica_slot_t*));
+    if (!rep->slots) goto fail;
+
+    for (int i = 0; i < num_nodes; i++) {
+        rep->slots[i] = g_nkit_ctx.numa_supported
+            ? numa_alloc_onnode(sizeof(nkit_replica_slot_t), i)
+            : aligned_alloc(64, sizeof(nkit_replica_slot_t));
+        if (!rep->slots[i]) goto fail;
+
+        atomic_init(&rep->slots[i]->readers[0], 0);
+        atomic_init(&rep->slots[i]->readers[1], 0);
+    }
+
+    nkit_replica_set_t* set = _set_build(rep, data, size, 0);
+    if (!set) goto fail;
+
+    atomic_init(&rep->current, set);
+    atomic_init(&rep->parity, 0);
+    pthread_mutex_init(&rep->publish_lock, NULL);
+    return rep;
+
+fail:
+    if (rep->slots) {
+        for (int i = 0; i < num_nodes; i++) {
+            if (rep->slots[i]) _slot_free(rep->slots[i]);
+        }
+        free(rep->slots);
+    }
+    free(rep);
+    return NULL;
+}
+
+const void* nkit_replica_read_lock(nkit_replica_t* rep, nkit_replica_read_t* read) {
+    if (!rep || !read) return NULL;
+
+    int node = nkit_get_current_node();
+    if (node < 0 || node >= rep->num_nodes) node = 0;
+
+    // Announce the reader *before* loading the version (both seq_cst):
+    // a publisher that swapped first is seen as the new version, one
+    // that swaps later finds this counter non-zero.
+    unsigned parity = atomic_load(&rep->parity) & 1;
+    atomic_fetch_add(&rep->slots[node]->readers[parity], 1);
+
+    nkit_replica_set_t* set = atomic_load(&rep->current);
+    read->data = _set_data(rep, set)[node];
+    read->size = set->size;
+    read->node = node;
+    read->slot = (int)parity;
+    return read->data;
+}
+
+void nkit_replica_read_unlock(nkit_replica_t* rep, nkit_replica_read_t* read) {
+    if (!rep || !read) return;
+    atomic_fetch_sub_explicit(&rep->slots[read->node]->readers[read->slot], 1,
+                              memory_order_release);
+}
+
+int nkit_replica_publish(nkit_replica_t* rep, const void* data, size_t size) {
+    if (!rep || !data || size == 0) return -1;
+
+    pthread_mutex_lock(&rep->publish_lock);
+
+    nkit_replica_set_t* old = atomic_load(&rep->current);
+    nkit_replica_set_t* set = _set_build(rep, data, size, old->version + 1);
+    if (!set) {
+        pthread_mutex_unlock(&rep->publish_lock);
+        return -1;
+    }
+
+    atomic_store(&rep->current, set);
+
+    // Grace period. A reader counts itself on a parity and only then
+    // loads the version, so a reader still holding 'old' is on one of
+    // the two counters. One that sampled the parity before the previous
+    // flip may sit on the idle counter, so drain that first; then flip
+    // and drain the active one. Readers arriving meanwhile load 'set'.
+    unsigned parity = atomic_load(&rep->parity) & 1;
+    _wait_readers(rep, parity ^ 1);
+    atomic_fetch_add(&rep->parity, 1);
+    _wait_readers(rep, parity);
+
+    _set_free(rep, old);
+    pthread_mutex_unlock(&rep->publish_lock);
+    return 0;
+}
+
+uint64_t nkit_replica_version(nkit_replica_t* rep) {
+    if (!rep) return 0;
+    pthread_mutex_lock(&rep->publish_lock);
+    uint64_t version = atomic_load(&rep->current)->version;
+    pthread_mutex_unlock(&rep->publish_lock);
+    return version;
+}
+
+void nkit_replica_destroy(nkit_replica_t* rep) {
+    if (!rep) return;
+
+    _set_free(rep, atomic_load(&rep->current));
+    for (int i = 0; i < rep->num_nodes; i++) {
+        _slot_free(rep->slots[i]);
+    }
+    free(rep->slots);
+    pthread_mutex_destroy(&rep->publish_lock);
+    free(rep);
+}
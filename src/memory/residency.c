@@ -0,0 +1,195 @@
+#define _GNU_SOURCE
+
+#include "../internal.h"
+#include <errno.h>
+#include <numa.h>
+#include <numaif.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+// ---------------------------------------------------------------------------
+// Configuration
+// ---------------------------------------------------------------------------
+#define RESIDENCY_BATCH       512  // Pages per move_pages call
+#define RESIDENCY_CACHE_SLOTS 64   // Direct-mapped cache of recent ranges
+
+typedef struct {
+    uintptr_t        base;     // First page (0 = empty slot)
+    size_t           npages;
+    nkit_residency_t hist;
+} nkit_residency_slot_t;
+
+static nkit_residency_slot_t g_residency_cache[RESIDENCY_CACHE_SLOTS];
+static uint64_t        g_residency_gen;  // Bumped by every invalidate
+static pthread_mutex_t g_residency_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static inline uint64_t _residency_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static inline size_t _residency_slot(uintptr_t base, size_t npages) {
+    // Mix the length in before multiplying, so it reaches the top bits
+    uint64_t h = (((uint64_t)base >> 12) ^ npages) * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h >> 58) & (RESIDENCY_CACHE_SLOTS - 1);
+}
+
+/**
+ * @brief UMA stand-in for move_pages: node 0 for resident pages, the same
+ *        -ENOENT / -EFAULT as move_pages for absent or unmapped ones.
+ */
+static void _query_pages_uma(uintptr_t base, size_t count, long page_size, int* status) {
+    unsigned char vec[RESIDENCY_BATCH];
+    for (size_t done = 0; done < count; done += RESIDENCY_BATCH) {
+        size_t n = count - done < RESIDENCY_BATCH ? count - done : RESIDENCY_BATCH;
+        uintptr_t addr = base + done * (uintptr_t)page_size;
+
+        if (mincore((void*)addr, n * (size_t)page_size, vec) == 0) {
+            for (size_t i = 0; i < n; i++) {
+                status[done + i] = (vec[i] & 1) ? 0 : -ENOENT;
+            }
+            continue;
+        }
+
+        // Part of the batch is not mapped: probe page by page
+        for (size_t i = 0; i < n; i++) {
+            void* page = (void*)(addr + i * (uintptr_t)page_size);
+            if (mincore(page, (size_t)page_size, vec) != 0) {
+                status[done + i] = -EFAULT;
+            } else {
+                status[done + i] = (vec[0] & 1) ? 0 : -ENOENT;
+            }
+        }
+    }
+}
+
+int _nkit_query_pages(uintptr_t base, size_t count, long page_size, int* status) {
+    if (numa_available() < 0) {
+        _query_pages_uma(base, count, page_size, status);
+        return 0;
+    }
+
+    // move_pages with nodes == NULL only queries: status[i] receives the
+    // node of each page (or -errno). Batched to bound the stack array.
+    void* pages[RESIDENCY_BATCH];
+    for (size_t done = 0; done < count; done += RESIDENCY_BATCH) {
+        size_t n = count - done < RESIDENCY_BATCH ? count - done : RESIDENCY_BATCH;
+        for (size_t i = 0; i < n; i++) {
+            pages[i] = (void*)(base + (done + i) * (uintptr_t)page_size);
+        }
+        if (move_pages(0, n, pages, NULL, status + done, 0) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Sample the range batch by batch and fold it into a histogram.
+ */
+static int _residency_sample(uintptr_t base, size_t npages, long page_size,
+                             nkit_residency_t* hist) {
+    memset(hist, 0, sizeof(*hist));
+    hist->pages = npages;
+
+    int status[RESIDENCY_BATCH];
+    for (size_t done = 0; done < npages; done += RESIDENCY_BATCH) {
+        size_t n = npages - done < RESIDENCY_BATCH ? npages - done : RESIDENCY_BATCH;
+        if (_nkit_query_pages(base + done * (uintptr_t)page_size, n, page_size, status) != 0) {
+            return -1;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (status[i] >= 0 && status[i] < NKIT_RESIDENCY_MAX_NODES) {
+                hist->per_node[status[i]]++;
+            } else if (status[i] == -ENOENT) {
+                hist->not_present++;
+            } else {
+                hist->unknown++;
+            }
+        }
+    }
+
+    hist->dominant_node = -1;
+    size_t best = 0;
+    for (int n = 0; n < NKIT_RESIDENCY_MAX_NODES; n++) {
+        if (hist->per_node[n] > best) {
+            best = hist->per_node[n];
+            hist->dominant_node = n;
+        }
+    }
+    hist->sampled_ns = _residency_now_ns();
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+int nkit_memory_residency(const void* ptr, size_t size, nkit_residency_t* out,
+                          unsigned max_age_ms) {
+    if (!ptr || !out || size == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t first = (uintptr_t)ptr & ~(uintptr_t)(page_size - 1);
+    uintptr_t last  = ((uintptr_t)ptr + size - 1) & ~(uintptr_t)(page_size - 1);
+    size_t npages = (last - first) / (uintptr_t)page_size + 1;
+    nkit_residency_slot_t* slot = &g_residency_cache[_residency_slot(first, npages)];
+
+    pthread_mutex_lock(&g_residency_lock);
+    uint64_t gen = g_residency_gen;
+    int hit = 0;
+    if (max_age_ms > 0) {
+        uint64_t max_age_ns = (uint64_t)max_age_ms * 1000000ULL;
+        hit = slot->base == first && slot->npages == npages &&
+              _residency_now_ns() - slot->hist.sampled_ns <= max_age_ns;
+        if (hit) *out = slot->hist;
+    }
+    pthread_mutex_unlock(&g_residency_lock);
+    if (hit) return 0;
+
+    // Sample outside the lock: the walk can take milliseconds on big ranges
+    if (_residency_sample(first, npages, page_size, out) != 0) {
+        return -1;
+    }
+
+    // An invalidate during the walk may cover pages already sampled:
+    // return the result, but do not cache it
+    pthread_mutex_lock(&g_residency_lock);
+    if (g_residency_gen == gen) {
+        slot->base = first;
+        slot->npages = npages;
+        slot->hist = *out;
+    }
+    pthread_mutex_unlock(&g_residency_lock);
+    return 0;
+}
+
+void nkit_memory_residency_invalidate(const void* ptr, size_t size) {
+    if (size == 0) return;
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t lo = (uintptr_t)ptr;
+    uintptr_t hi = lo + size;
+
+    pthread_mutex_lock(&g_residency_lock);
+    g_residency_gen++;
+    for (size_t i = 0; i < RESIDENCY_CACHE_SLOTS; i++) {
+        nkit_residency_slot_t* slot = &g_residency_cache[i];
+        if (!slot->base) continue;
+
+        uintptr_t end = slot->base + slot->npages * (uintptr_t)page_size;
+        if (slot->base < hi && lo < end) slot->base = 0;
+    }
+    pthread_mutex_unlock(&g_residency_lock);
+}
@@ -2,43 +2,251 @@
 
 #include <numakit/memory.h>
 #include <numakit/structs/ring_buffer.h>
+#include "../internal.h"
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 
-// Cache-line alignment for object slots
-#define SLAB_ALIGN 64
+// Cache-line alignment for object slots; tagged slabs may ask for up to
+// a page (extents then start on that boundary)
+#define SLAB_ALIGN     64
+#define SLAB_MAX_ALIGN 4096
+
+// Extent lifecycle
+#define EXTENT_ACTIVE   1  // Objects circulate through the extent free-list
+#define EXTENT_RELEASED 2  // Fully drained; pages returned to the OS
+
+/**
+ * @brief A node-local block of object slots with its own free-list.
+ *
+ * Extents are never unmapped while the slab lives: releasing one drains
+ * its free-list (proving every object is free) and then returns the
+ * pages via nkit_arena_coalesce(). Readers that still look at a
+ * released extent simply find its ring empty.
+ *
+ * Every page of the extent is registered in the page map with 'desc',
+ * which is how a bare object pointer finds its extent (and slab).
+ */
+typedef struct {
+    _nkit_page_owner_t desc;   // Page-map record (must stay first)
+    nkit_arena_t *arena;       // Backing memory arena (hugepage-backed)
+    nkit_ring_t  *freelist;    // Lock-free MPMC ring of free slots in this extent
+    void         *base;        // First object slot
+    size_t        capacity;    // Object slots in this extent
+    size_t        bytes;       // obj_size * capacity
+    atomic_int    state;       // EXTENT_ACTIVE / EXTENT_RELEASED
+} nkit_slab_extent_t;
 
 /**
  * @brief Internal slab structure.
  *
- * The slab carves a contiguous memory arena into fixed-size chunks and
- * manages a lock-free ring buffer as a free-list.  Both the arena and
- * the ring are pinned to the same NUMA node, guaranteeing that
- * allocations never touch remote memory.
+ * The slab carves node-local extents into fixed-size chunks and
+ * manages a lock-free ring buffer per extent as a free-list.  All
+ * arenas and rings are pinned to the same NUMA node, guaranteeing that
+ * allocations never touch remote memory.  Elastic slabs add extents
+ * when exhausted; fixed slabs have exactly one.  Unbounded slabs double
+ * each new extent, so a handful of extents covers any working set and
+ * the node's memory, not the extent table, limits growth.
  */
 struct nkit_slab_s {
-    nkit_arena_t *arena;       // Backing memory arena (hugepage-backed)
-    nkit_ring_t  *freelist;    // Lock-free MPMC ring used as the free-list
-    void         *base;        // Start of the object memory region
-    size_t        obj_size;    // Aligned object size (>= user-requested size)
-    size_t        capacity;    // Total number of object slots
+    size_t        obj_size;        // Aligned object size (>= user-requested size)
+    size_t        extent_capacity; // Object slots of the first extent (and of every
+                                   // extent of a bounded slab)
+    size_t        align;           // Slot alignment (extent bases honour it)
+    size_t        max_extents;     // Growth limit (1 = fixed capacity)
+    int           doubling;        // 1 if each new extent doubles the last one
+    int           node_id;         // NUMA node every extent is bound to
+    uint32_t      tag;             // Copied into every extent's page-map record
+
+    atomic_size_t num_extents;     // Extents created so far (never decreases)
+    atomic_size_t hint;            // Extent most likely to have free slots
+    pthread_mutex_t grow_lock;     // Serializes grow / shrink
+    nkit_slab_t  *reg_prev;        // Live-slab registry links (telemetry)
+    nkit_slab_t  *reg_next;
+
+    nkit_slab_extent_t extents[NKIT_SLAB_MAX_EXTENTS];
 };
 
+// Every live slab, so telemetry can count objects in use without
+// touching the alloc/free paths
+static pthread_mutex_t g_slab_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static nkit_slab_t    *g_slab_registry;
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Push every slot of an extent into its (empty) free-list.
+ */
+static void _extent_populate(nkit_slab_t *slab, nkit_slab_extent_t *ext) {
+    for (size_t i = 0; i < ext->capacity; i++) {
+        void *slot = (char *)ext->base + (i * slab->obj_size);
+        nkit_ring_push(ext->freelist, slot);
+    }
+    atomic_store_explicit(&ext->state, EXTENT_ACTIVE, memory_order_release);
+}
+
+/**
+ * @brief Publish the extent's pages in the page map.
+ * @return 0 on success, -1 if the page map could not grow.
+ */
+static int _extent_register(nkit_slab_t *slab, nkit_slab_extent_t *ext) {
+    ext->desc.owner = slab;
+    ext->desc.tag   = slab->tag;
+    ext->desc.node  = slab->node_id;
+    return _nkit_pagemap_set(ext->base, ext->bytes, &ext->desc);
+}
+
+/**
+ * @brief Map a new extent of 'capacity' slots (arena + ring) on the slab's node.
+ * @return 0 on success, -1 on failure.
+ */
+static int _extent_init(nkit_slab_t *slab, nkit_slab_extent_t *ext, size_t capacity) {
+    ext->capacity = capacity;
+    ext->bytes    = slab->obj_size * capacity;
+    ext->arena = nkit_arena_create(slab->node_id, ext->bytes);
+    if (!ext->arena) return -1;
+
+    ext->base = nkit_arena_alloc_aligned(ext->arena, ext->bytes, slab->align);
+    ext->freelist = ext->base ? nkit_ring_create(slab->node_id, capacity) : NULL;
+    if (!ext->freelist) {
+        nkit_arena_destroy(ext->arena);
+        ext->arena = NULL;
+        return -1;
+    }
+
+    if (_extent_register(slab, ext) != 0) {
+        nkit_ring_free(ext->freelist);
+        nkit_arena_destroy(ext->arena);
+        ext->arena = NULL;
+        return -1;
+    }
+
+    _extent_populate(slab, ext);
+    return 0;
+}
+
+/**
+ * @brief Map extent 'n': as large as the first one, or for unbounded
+ * slabs twice the previous one. If the node cannot hold that, halve
+ * back towards the first extent's size before giving up.
+ * @return 0 on success, -1 if the node is out of memory.
+ */
+static int _extent_grow(nkit_slab_t *slab, size_t n) {
+    size_t capacity = slab->extent_capacity;
+    if (slab->doubling) {
+        size_t prev = slab->extents[n - 1].capacity;
+        capacity = prev <= SIZE_MAX / 4 / slab->obj_size ? prev * 2 : prev;
+    }
+
+    for (;;) {
+        if (_extent_init(slab, &slab->extents[n], capacity) == 0) return 0;
+        if (capacity <= slab->extent_capacity) return -1;
+        capacity /= 2;
+    }
+}
+
+/**
+ * @brief Find the extent that owns 'ptr', or NULL.
+ */
+static inline nkit_slab_extent_t *_extent_of(nkit_slab_t *slab, const void *ptr) {
+    const _nkit_page_owner_t *desc = _nkit_pagemap_get(ptr);
+    if (!desc || desc->owner != slab) return NULL;
+    return (nkit_slab_extent_t *)desc;
+}
+
+static inline size_t _ring_count(nkit_ring_t *ring) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    return head >= tail ? (head - tail) : 0;
+}
+
+/**
+ * @brief Slow path: scan every extent, then grow by one extent.
+ *
+ * Growth prefers re-activating a released extent (its mapping and ring
+ * still exist) over mapping a new one.
+ */
+static void *_slab_alloc_slow(nkit_slab_t *slab) {
+    void *ptr = NULL;
+
+    // 1. Another extent may still have free slots
+    size_t n = atomic_load_explicit(&slab->num_extents, memory_order_acquire);
+    for (size_t i = 0; i < n; i++) {
+        if (nkit_ring_pop(slab->extents[i].freelist, &ptr)) {
+            atomic_store_explicit(&slab->hint, i, memory_order_relaxed);
+            return ptr;
+        }
+    }
+
+    if (slab->max_extents <= 1) {
+        _nkit_stat_add(_NKIT_STAT_SLAB_EXHAUSTED, slab->node_id, 1);
+        return NULL; // Fixed slab exhausted
+    }
+
+    // 2. Grow (one thread at a time; others may have grown meanwhile)
+    pthread_mutex_lock(&slab->grow_lock);
+
+    n = atomic_load_explicit(&slab->num_extents, memory_order_relaxed);
+    size_t target = n;
+    for (size_t i = 0; i < n; i++) {
+        nkit_slab_extent_t *ext = &slab->extents[i];
+        if (nkit_ring_pop(ext->freelist, &ptr)) {
+            target = i;
+            break;
+        }
+        if (atomic_load_explicit(&ext->state, memory_order_relaxed) == EXTENT_RELEASED) {
+            _extent_populate(slab, ext);
+            nkit_ring_pop(ext->freelist, &ptr);
+            target = i;
+            break;
+        }
+    }
+
+    if (!ptr && n < slab->max_extents) {
+        nkit_slab_extent_t *ext = &slab->extents[n];
+        if (_extent_grow(slab, n) == 0) {
+            atomic_store_explicit(&slab->num_extents, n + 1, memory_order_release);
+            nkit_ring_pop(ext->freelist, &ptr);
+            target = n;
+        }
+    }
+
+    if (ptr) {
+        atomic_store_explicit(&slab->hint, target, memory_order_relaxed);
+    } else {
+        _nkit_stat_add(_NKIT_STAT_SLAB_EXHAUSTED, slab->node_id, 1);
+    }
+    pthread_mutex_unlock(&slab->grow_lock);
+
+    return ptr; // NULL: growth limit reached or node out of memory
+}
+
 // ---------------------------------------------------------------------------
 // Public API
 // ---------------------------------------------------------------------------
 
-nkit_slab_t *nkit_slab_create(int node_id, size_t obj_size, size_t capacity) {
-    // 1. Validate: capacity must be a power-of-2 >= 2
-    if (capacity < 2 || (capacity & (capacity - 1)) != 0) return NULL;
+nkit_slab_t *_nkit_slab_create_tagged(int node_id, size_t obj_size, size_t align,
+                                      size_t extent_capacity, size_t max_extents,
+                                      uint32_t tag) {
+    // 1. Validate: capacity must be a power-of-2 >= 2, alignment a power-of-2
+    //    no larger than a page
+    if (extent_capacity < 2 || (extent_capacity & (extent_capacity - 1)) != 0) return NULL;
     if (obj_size == 0) return NULL;
+    if (align == 0 || (align & (align - 1)) != 0 || align > SLAB_MAX_ALIGN) return NULL;
+    int doubling = max_extents == 0;
+    if (max_extents == 0 || max_extents > NKIT_SLAB_MAX_EXTENTS) {
+        max_extents = NKIT_SLAB_MAX_EXTENTS;
+    }
 
-    // 2. Align object size up to cache-line boundary
-    size_t aligned = (obj_size + SLAB_ALIGN - 1) & ~(size_t)(SLAB_ALIGN - 1);
+    // 2. Align object size up to the slot alignment
+    size_t aligned = (obj_size + align - 1) & ~(size_t)(align - 1);
 
-    // 3. Create backing arena large enough for the slab struct + all objects
-    size_t data_bytes  = aligned * capacity;
-    size_t total_bytes = sizeof(struct nkit_slab_s) + data_bytes;
+    // 3. Create the first arena large enough for the slab struct + one extent
+    size_t data_bytes  = aligned * extent_capacity;
+    size_t header      = (sizeof(struct nkit_slab_s) + align - 1) & ~(align - 1);
+    size_t total_bytes = header + data_bytes;
 
     nkit_arena_t *arena = nkit_arena_create(node_id, total_bytes);
     if (!arena) return NULL;
@@ -50,58 +258,204 @@ nkit_slab_t *nkit_slab_create(int node_id, size_t obj_size, size_t capacity) {
         return NULL;
     }
 
-    // 5. Allocate the contiguous object memory block from the arena
-    void *base = nkit_arena_alloc(arena, data_bytes);
+    // 5. Allocate the contiguous object memory block of extent 0 from the arena
+    void *base = nkit_arena_alloc_aligned(arena, data_bytes, align);
     if (!base) {
         nkit_arena_destroy(arena);
         return NULL;
     }
 
     // 6. Create the lock-free ring buffer (free-list) on the same node
-    nkit_ring_t *ring = nkit_ring_create(node_id, capacity);
+    nkit_ring_t *ring = nkit_ring_create(node_id, extent_capacity);
     if (!ring) {
         nkit_arena_destroy(arena);
         return NULL;
     }
 
-    // 7. Populate: push every slot pointer into the free-list
-    for (size_t i = 0; i < capacity; i++) {
-        void *slot = (char *)base + (i * aligned);
-        nkit_ring_push(ring, slot);
+    // 7. Fill out the slab descriptor
+    slab->obj_size        = aligned;
+    slab->extent_capacity = extent_capacity;
+    slab->align           = align;
+    slab->max_extents     = max_extents;
+    slab->doubling        = doubling;
+    slab->node_id         = node_id;
+    slab->tag             = tag;
+    atomic_init(&slab->num_extents, 1);
+    atomic_init(&slab->hint, 0);
+    pthread_mutex_init(&slab->grow_lock, NULL);
+
+    // 8. Populate: push every slot pointer of extent 0 into its free-list
+    slab->extents[0].arena    = arena;
+    slab->extents[0].freelist = ring;
+    slab->extents[0].base     = base;
+    slab->extents[0].capacity = extent_capacity;
+    slab->extents[0].bytes    = data_bytes;
+    if (_extent_register(slab, &slab->extents[0]) != 0) {
+        pthread_mutex_destroy(&slab->grow_lock);
+        nkit_ring_free(ring);
+        nkit_arena_destroy(arena);
+        return NULL;
     }
+    _extent_populate(slab, &slab->extents[0]);
 
-    // 8. Fill out the slab descriptor
-    slab->arena    = arena;
-    slab->freelist = ring;
-    slab->base     = base;
-    slab->obj_size = aligned;
-    slab->capacity = capacity;
+    pthread_mutex_lock(&g_slab_registry_lock);
+    slab->reg_prev = NULL;
+    slab->reg_next = g_slab_registry;
+    if (g_slab_registry) g_slab_registry->reg_prev = slab;
+    g_slab_registry = slab;
+    pthread_mutex_unlock(&g_slab_registry_lock);
 
     return slab;
 }
 
+int _nkit_slab_node(const nkit_slab_t *slab) {
+    return slab->node_id;
+}
+
+nkit_slab_t *nkit_slab_create_elastic(int node_id, size_t obj_size, size_t extent_capacity,
+                                      size_t max_extents) {
+    return _nkit_slab_create_tagged(node_id, obj_size, SLAB_ALIGN, extent_capacity,
+                                    max_extents, 0);
+}
+
+nkit_slab_t *nkit_slab_create(int node_id, size_t obj_size, size_t capacity) {
+    return nkit_slab_create_elastic(node_id, obj_size, capacity, 1);
+}
+
 void *nkit_slab_alloc(nkit_slab_t *slab) {
     if (!slab) return NULL;
 
     void *ptr = NULL;
-    if (nkit_ring_pop(slab->freelist, &ptr)) {
+    size_t hint = atomic_load_explicit(&slab->hint, memory_order_relaxed);
+    if (nkit_ring_pop(slab->extents[hint].freelist, &ptr)) {
         return ptr;
     }
-    return NULL; // Slab exhausted
+    return _slab_alloc_slow(slab);
 }
 
 void nkit_slab_free(nkit_slab_t *slab, void *ptr) {
     if (!slab || !ptr) return;
-    nkit_ring_push(slab->freelist, ptr);
+
+    nkit_slab_extent_t *ext = _extent_of(slab, ptr);
+    if (ext) {
+        nkit_ring_push(ext->freelist, ptr);
+    }
+}
+
+size_t nkit_slab_alloc_bulk(nkit_slab_t *slab, void **objs, size_t n) {
+    if (!slab || !objs || n == 0) return 0;
+
+    size_t got = 0;
+    nkit_ring_t *ring = slab->extents[atomic_load_explicit(&slab->hint, memory_order_relaxed)].freelist;
+    while (got < n && nkit_ring_pop(ring, &objs[got])) {
+        got++;
+    }
+
+    if (got == 0) {
+        // Hint extent empty: let the slow path find (or grow) another one,
+        // then take the rest of the batch from it.
+        objs[0] = _slab_alloc_slow(slab);
+        if (!objs[0]) return 0;
+        got = 1;
+
+        ring = slab->extents[atomic_load_explicit(&slab->hint, memory_order_relaxed)].freelist;
+        while (got < n && nkit_ring_pop(ring, &objs[got])) {
+            got++;
+        }
+    }
+    return got;
+}
+
+void nkit_slab_free_bulk(nkit_slab_t *slab, void *const *objs, size_t n) {
+    if (!slab || !objs) return;
+
+    nkit_slab_extent_t *ext = NULL;
+    for (size_t i = 0; i < n; i++) {
+        // Batches usually come from one extent: re-check before searching
+        const char *p = (const char *)objs[i];
+        if (!ext || p < (const char *)ext->base ||
+            p >= (const char *)ext->base + ext->bytes) {
+            ext = _extent_of(slab, p);
+            if (!ext) continue;
+        }
+        nkit_ring_push(ext->freelist, objs[i]);
+    }
+}
+
+size_t nkit_slab_shrink(nkit_slab_t *slab) {
+    if (!slab || slab->max_extents <= 1) return 0;
+
+    size_t released = 0;
+    pthread_mutex_lock(&slab->grow_lock);
+
+    // Extent 0 hosts the slab itself and is never released
+    size_t n = atomic_load_explicit(&slab->num_extents, memory_order_relaxed);
+    void **drained = NULL;
+    size_t drained_cap = 0;
+
+    for (size_t i = 1; i < n; i++) {
+        nkit_slab_extent_t *ext = &slab->extents[i];
+        if (atomic_load_explicit(&ext->state, memory_order_relaxed) != EXTENT_ACTIVE) continue;
+        if (_ring_count(ext->freelist) != ext->capacity) continue;
+
+        if (drained_cap < ext->capacity) {
+            free(drained);
+            drained = malloc(ext->capacity * sizeof(void *));
+            if (!drained) break;
+            drained_cap = ext->capacity;
+        }
+
+        // Drain the free-list: owning every slot proves the extent is idle.
+        // If an allocator races us, put back what we took and move on.
+        size_t got = 0;
+        while (got < ext->capacity && nkit_ring_pop(ext->freelist, &drained[got])) {
+            got++;
+        }
+        if (got != ext->capacity) {
+            for (size_t j = 0; j < got; j++) {
+                nkit_ring_push(ext->freelist, drained[j]);
+            }
+            continue;
+        }
+
+        atomic_store_explicit(&ext->state, EXTENT_RELEASED, memory_order_release);
+        if (atomic_load_explicit(&slab->hint, memory_order_relaxed) == i) {
+            atomic_store_explicit(&slab->hint, 0, memory_order_relaxed);
+        }
+
+        // Return the pages; the mapping stays valid for re-activation
+        nkit_arena_reset(ext->arena);
+        nkit_arena_coalesce(ext->arena);
+        released++;
+    }
+
+    pthread_mutex_unlock(&slab->grow_lock);
+    free(drained);
+    return released;
 }
 
 void nkit_slab_destroy(nkit_slab_t *slab) {
     if (!slab) return;
 
-    // Free the ring buffer first (it has its own arena)
-    nkit_ring_t *ring = slab->freelist;
-    nkit_arena_t *arena = slab->arena;
+    pthread_mutex_lock(&g_slab_registry_lock);
+    if (slab->reg_prev) slab->reg_prev->reg_next = slab->reg_next;
+    else                g_slab_registry = slab->reg_next;
+    if (slab->reg_next) slab->reg_next->reg_prev = slab->reg_prev;
+    pthread_mutex_unlock(&g_slab_registry_lock);
+
+    // Extent 0's arena holds the slab struct itself: free it last
+    size_t n = atomic_load_explicit(&slab->num_extents, memory_order_acquire);
+    for (size_t i = n; i-- > 1;) {
+        _nkit_pagemap_set(slab->extents[i].base, slab->extents[i].bytes, NULL);
+        nkit_ring_free(slab->extents[i].freelist);
+        nkit_arena_destroy(slab->extents[i].arena);
+    }
+
+    nkit_ring_t *ring = slab->extents[0].freelist;
+    nkit_arena_t *arena = slab->extents[0].arena;
 
+    _nkit_pagemap_set(slab->extents[0].base, slab->extents[0].bytes, NULL);
+    pthread_mutex_destroy(&slab->grow_lock);
     if (ring) nkit_ring_free(ring);
     if (arena) nkit_arena_destroy(arena);
 }
@@ -109,15 +463,68 @@ void nkit_slab_destroy(nkit_slab_t *slab) {
 size_t nkit_slab_available(nkit_slab_t *slab) {
     if (!slab) return 0;
 
-    // Available slots = capacity - (head - tail)
+    // Available slots = sum over extents of (head - tail)
     // head and tail are atomic; this is an approximate snapshot.
-    size_t head = atomic_load_explicit(&slab->freelist->head, memory_order_relaxed);
-    size_t tail = atomic_load_explicit(&slab->freelist->tail, memory_order_relaxed);
-
-    return head >= tail ? (head - tail) : 0;
+    size_t total = 0;
+    size_t n = atomic_load_explicit(&slab->num_extents, memory_order_acquire);
+    for (size_t i = 0; i < n; i++) {
+        total += _ring_count(slab->extents[i].freelist);
+    }
+    return total;
 }
 
 size_t nkit_slab_capacity(nkit_slab_t *slab) {
     if (!slab) return 0;
-    return slab->capacity;
+
+    // Capacity of all active extents
+    size_t total = 0;
+    size_t n = atomic_load_explicit(&slab->num_extents, memory_order_acquire);
+    for (size_t i = 0; i < n; i++) {
+        if (atomic_load_explicit(&slab->extents[i].state, memory_order_relaxed) == EXTENT_ACTIVE) {
+            total += slab->extents[i].capacity;
+        }
+    }
+    return total;
+}
+
+void _nkit_slab_in_use(uint64_t *per_node, int num_nodes) {
+    pthread_mutex_lock(&g_slab_registry_lock);
+    for (nkit_slab_t *slab = g_slab_registry; slab; slab = slab->reg_next) {
+        if (slab->node_id < 0 || slab->node_id >= num_nodes) continue;
+
+        // Both sides are racy snapshots; never report a negative count
+        size_t capacity  = nkit_slab_capacity(slab);
+        size_t available = nkit_slab_available(slab);
+        if (capacity > available) {
+            per_node[slab->node_id] += (uint64_t)(capacity - available) * slab->obj_size;
+        }
+    }
+    pthread_mutex_unlock(&g_slab_registry_lock);
+}
+
+// ---------------------------------------------------------------------------
+// Fork Support
+// ---------------------------------------------------------------------------
+
+void _nkit_slab_prefork(void) {
+    // Grow paths never take the registry lock, so this order is safe
+    pthread_mutex_lock(&g_slab_registry_lock);
+    for (nkit_slab_t *slab = g_slab_registry; slab; slab = slab->reg_next) {
+        pthread_mutex_lock(&slab->grow_lock);
+    }
+}
+
+void _nkit_slab_postfork_parent(void) {
+    for (nkit_slab_t *slab = g_slab_registry; slab; slab = slab->reg_next) {
+        pthread_mutex_unlock(&slab->grow_lock);
+    }
+    pthread_mutex_unlock(&g_slab_registry_lock);
+}
+
+void _nkit_slab_postfork_child(void) {
+    // The threads that held these locks do not exist in the child
+    for (nkit_slab_t *slab = g_slab_registry; slab; slab = slab->reg_next) {
+        pthread_mutex_init(&slab->grow_lock, NULL);
+    }
+    pthread_mutex_init(&g_slab_registry_lock, NULL);
 }
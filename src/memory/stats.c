@@ -0,0 +1,88 @@
+#define _GNU_SOURCE
+
+#include "../internal.h"
+#include <errno.h>
+#include <numa.h>
+#include <pthread.h>
+#include <string.h>
+
+/*
+ * One partitioned counter per statistic. Slot n is node n's value: it
+ * lives on node n and sits on its own cache line, so allocators of
+ * different nodes never contend on an update. Counters are created on
+ * first use and live as long as the process.
+ *
+ * Slab objects in use are not counted on the alloc/free fast paths;
+ * the snapshot derives them from the live slabs instead.
+ */
+static nkit_pcounter_t* g_stats[_NKIT_STAT_COUNT];
+static int              g_stats_nodes;
+static pthread_once_t   g_stats_once = PTHREAD_ONCE_INIT;
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static void _stats_init(void) {
+    // Size from the kernel, not g_nkit_ctx: arenas may predate nkit_init()
+    int nodes = numa_available() < 0 ? 1 : numa_max_node() + 1;
+    if (nodes > NKIT_STATS_MAX_NODES) nodes = NKIT_STATS_MAX_NODES;
+
+    for (int i = 0; i < _NKIT_STAT_COUNT; i++) {
+        g_stats[i] = _nkit_pcounter_create_n(nodes);
+    }
+    g_stats_nodes = nodes;
+}
+
+static inline uint64_t _stats_read(_nkit_stat_t stat, int node) {
+    if (!g_stats[stat]) return 0;
+    int64_t v = _nkit_pcounter_read_slot(g_stats[stat], node);
+    return v > 0 ? (uint64_t)v : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Internal API
+// ---------------------------------------------------------------------------
+
+void _nkit_stat_add(_nkit_stat_t stat, int node, int64_t delta) {
+    pthread_once(&g_stats_once, _stats_init);
+    if (g_stats[stat]) {
+        _nkit_pcounter_add_slot(g_stats[stat], node, delta);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+int nkit_mem_stats_snapshot(nkit_mem_stats_t* out) {
+    if (!out) {
+        errno = EINVAL;
+        return -1;
+    }
+    pthread_once(&g_stats_once, _stats_init);
+
+    memset(out, 0, sizeof(*out));
+    out->num_nodes = g_stats_nodes;
+
+    uint64_t slab_bytes[NKIT_STATS_MAX_NODES] = { 0 };
+    _nkit_slab_in_use(slab_bytes, g_stats_nodes);
+
+    for (int n = 0; n < g_stats_nodes; n++) {
+        nkit_node_mem_stats_t* s = &out->nodes[n];
+        s->bytes_huge       = _stats_read(_NKIT_STAT_MAPPED_HUGE, n);
+        s->bytes_4k         = _stats_read(_NKIT_STAT_MAPPED_4K, n);
+        s->bytes_mapped     = s->bytes_huge + s->bytes_4k;
+        s->bytes_in_use     = _stats_read(_NKIT_STAT_IN_USE, n) + slab_bytes[n];
+        s->remote_fallbacks = _stats_read(_NKIT_STAT_REMOTE_FALLBACK, n);
+        s->slab_exhausted   = _stats_read(_NKIT_STAT_SLAB_EXHAUSTED, n);
+
+        out->total.bytes_huge       += s->bytes_huge;
+        out->total.bytes_4k         += s->bytes_4k;
+        out->total.bytes_mapped     += s->bytes_mapped;
+        out->total.bytes_in_use     += s->bytes_in_use;
+        out->total.remote_fallbacks += s->remote_fallbacks;
+        out->total.slab_exhausted   += s->slab_exhausted;
+    }
+    return 0;
+}
@@ -2,46 +2,105 @@
 
 #include <numakit/sched.h>
 #include <numakit/sync.h>
-#include <numakit/structs/ring_buffer.h>
+#include <numakit/structs/mpsc_queue.h>
 
 #include <stddef.h>
 
+#define MSG_BATCH 32  // Messages popped per burst
+
+/**
+ * @brief Resolve the calling thread's mailbox, or NULL.
+ */
+static nkit_mailbox_t* _local_mailbox(void) {
+    int current_node = nkit_current_node();
+
+    // Safety check: invalid node
+    if (current_node < 0 || current_node >= g_nkit_ctx.num_nodes) {
+        return NULL;
+    }
+    return g_nkit_ctx.mailboxes[current_node];
+}
+
+/**
+ * @brief Drain up to 'limit' messages (0 = all). Caller holds 'draining'.
+ */
+static size_t _drain(nkit_mailbox_t* mb, void (*handler)(void*), size_t limit) {
+    size_t processed = 0;
+    void* batch[MSG_BATCH];
+
+    // Drain in bursts until empty OR limit reached
+    while (limit == 0 || processed < limit) {
+        size_t want = MSG_BATCH;
+        if (limit != 0 && limit - processed < want) want = limit - processed;
+
+        size_t got = nkit_mpsc_pop_burst(mb->queue, batch, want);
+        if (got == 0) break;
+
+        if (handler) {
+            for (size_t i = 0; i < got; i++) handler(batch[i]);
+        }
+        processed += got;
+    }
+    return processed;
+}
+
 /**
  * @brief Send a message (pointer) to a specific NUMA node.
- * Lock-Free MPSC.
+ * Lock-Free MPSC. The mailbox is unbounded: a burst grows it by
+ * node-local segments instead of being rejected.
  * @return 0 on success
  * @return -1 on invalid node
- * @return -2 on buffer full (congestion)
+ * @return -2 if the target node is out of memory for a new segment
  */
 int nkit_send(int target_node, void* data) {
     if (target_node < 0 || target_node >= g_nkit_ctx.num_nodes) return -1;
 
     // Direct access: No MCS lock needed (MPSC safe)
-    nkit_ring_t* ring = g_nkit_ctx.mailboxes[target_node]->ring;
+    nkit_mpsc_t* queue = g_nkit_ctx.mailboxes[target_node]->queue;
+
+    if (nkit_mpsc_push(queue, data) != 0) return -2;
 
-    // Returns false if ring is full
-    return nkit_ring_push(ring, data) ? 0 : -2;
+    // Wake the node's consumer if it is parked in nkit_process_local_wait
+    nkit_mpsc_notify(queue);
+    return 0;
 }
 
 size_t nkit_process_local(void (*handler)(void*), size_t limit) {
-    int current_node = nkit_current_node();
+    nkit_mailbox_t* mb = _local_mailbox();
+    if (!mb) return 0;
 
-    // Safety check: invalid node
-    if (current_node < 0 || current_node >= g_nkit_ctx.num_nodes) {
+    // Single consumer: another thread of this node is already draining
+    if (atomic_flag_test_and_set_explicit(&mb->draining, memory_order_acquire)) {
+        return 0;
+    }
+
+    size_t processed = _drain(mb, handler, limit);
+
+    atomic_flag_clear_explicit(&mb->draining, memory_order_release);
+    return processed;
+}
+
+size_t nkit_process_local_wait(void (*handler)(void*), size_t limit, int timeout_ms) {
+    nkit_mailbox_t* mb = _local_mailbox();
+    if (!mb) return 0;
+
+    if (atomic_flag_test_and_set_explicit(&mb->draining, memory_order_acquire)) {
         return 0;
     }
 
-    nkit_ring_t* ring = g_nkit_ctx.mailboxes[current_node]->ring;
+    // Block for the first message, then drain like nkit_process_local
     size_t processed = 0;
     void* data = NULL;
-
-    // Loop until empty OR limit reached
-    while ((limit == 0 || processed < limit) && nkit_ring_pop(ring, &data)) {
+    if (nkit_mpsc_pop_wait(mb->queue, &data, timeout_ms)) {
         if (handler) {
             handler(data);
         }
-        processed++;
+        processed = 1;
+        if (limit != 1) {
+            processed += _drain(mb, handler, limit ? limit - 1 : 0);
+        }
     }
 
+    atomic_flag_clear_explicit(&mb->draining, memory_order_release);
     return processed;
 }
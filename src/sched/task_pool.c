@@ -38,6 +38,7 @@ typedef struct {
     int threads_started;
     int* steal_order; 
     struct nkit_pool_s* global_pool; 
+    nkit_eventcount_t work;      // Idle workers of this node park here
 } nkit_node_pool_t;
 
 struct nkit_pool_s {
@@ -50,6 +51,8 @@ struct nkit_pool_s {
 // Helpers
 // -----------------------------------------------------------------------------
 
+#define WORKER_PARK_SPINS 5000  // Idle polls before a worker parks
+
 // Progressive Backoff Helper
 static inline void nkit_backoff(int* spin_count) {
     if (*spin_count < 2000) {
@@ -65,6 +68,36 @@ static inline void nkit_backoff(int* spin_count) {
     (*spin_count)++;
 }
 
+// True if this node's queue, or one it steals from, has work
+static inline int _nkit_worker_has_work(nkit_node_pool_t* np) {
+    if (nkit_deque_size(np->task_queue) > 0) return 1;
+    if (!np->steal_order) return 0;
+
+    struct nkit_pool_s* pool = np->global_pool;
+    for (int i = 0; i < pool->num_nodes - 1; i++) {
+        if (nkit_deque_size(pool->node_pools[np->steal_order[i]].task_queue) > 0) return 1;
+    }
+    return 0;
+}
+
+// Idle worker: spin/yield first, then sleep until a submit wakes us,
+// either to this node or (to steal) to a node with no idle worker
+static inline void _nkit_worker_idle(nkit_node_pool_t* np, int* spin_count) {
+    if (*spin_count < WORKER_PARK_SPINS) {
+        nkit_backoff(spin_count);
+        return;
+    }
+
+    // The re-check covers every queue we steal from: a submit there either
+    // sees us registered or we see its task
+    uint32_t key = nkit_ec_prepare_wait(&np->work);
+    if (np->global_pool->stop || _nkit_worker_has_work(np)) {
+        nkit_ec_cancel_wait(&np->work);
+        return;
+    }
+    nkit_ec_wait(&np->work, key, -1);
+}
+
 // Round up to next power of 2 for fast ring buffer bitwise operations
 static uint32_t _next_power_of_2(uint32_t v) {
     v--;
@@ -133,7 +166,7 @@ static void* _nkit_worker(void* arg) {
 
         // 3. Progressive Idle
         if (!stole) {
-            nkit_backoff(&idle_spins);
+            _nkit_worker_idle(my_pool, &idle_spins);
         }
     }
     return NULL;
@@ -169,6 +202,7 @@ nkit_pool_t* nkit_pool_create(void) {
         np->threads_started = 0;
         np->global_pool = pool; 
         np->capacity = ring_capacity;
+        nkit_ec_init(&np->work);
 
         np->task_queue = nkit_deque_create(i, ring_capacity);
         np->free_queue = nkit_ring_create(i, ring_capacity);
@@ -236,6 +270,15 @@ int nkit_pool_submit_to_node(nkit_pool_t* pool, int target_node, void (*func)(vo
     while (!nkit_deque_push(np->task_queue, task)) {
         nkit_backoff(&submit_spins);
     }
+
+    // Free unless a worker is parked. With no idle worker on the target
+    // node, wake the nearest parked thief instead, so the task does not
+    // wait for a busy node.
+    if (!nkit_ec_notify(&np->work) && np->steal_order) {
+        for (int i = 0; i < pool->num_nodes - 1; i++) {
+            if (nkit_ec_notify(&pool->node_pools[np->steal_order[i]].work)) break;
+        }
+    }
     return 0;
 }
 
@@ -256,6 +299,10 @@ void nkit_pool_destroy(nkit_pool_t* pool) {
     if (!pool) return;
 
     pool->stop = 1;
+    for (int i = 0; i < pool->num_nodes; i++) {
+        nkit_ec_notify_all(&pool->node_pools[i].work);
+    }
+
     for (int i = 0; i < pool->num_nodes; i++) {
         nkit_node_pool_t* np = &pool->node_pools[i];
 
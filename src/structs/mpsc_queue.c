@@ -0,0 +1,222 @@
+#include <numakit/structs/mpsc_queue.h>
+#include <numakit/memory.h>
+#include <numakit/sync.h>
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+// ---------------------------------------------------------------------------
+// Configuration
+// ---------------------------------------------------------------------------
+#define MPSC_SEG_BYTES    4096                                  // One page per segment
+#define MPSC_SEG_SLOTS    ((MPSC_SEG_BYTES - 64) / sizeof(void*))
+#define MPSC_SEG_PER_EXT  64      // Segments in the first slab extent (256KB)
+#define MPSC_WAIT_SPINS   256     // Polls before a consumer parks
+
+// Marks a slot whose producer has not stored its item yet (NULL is a
+// valid item)
+static char g_mpsc_empty;
+#define MPSC_EMPTY ((void*)&g_mpsc_empty)
+
+typedef struct nkit_mpsc_seg_s {
+    // Producer line
+    alignas(64) _Atomic(uint32_t) claimed;        // Slots handed out (may overshoot)
+    _Atomic(uint32_t)             users;          // Producers inside this segment
+    _Atomic(struct nkit_mpsc_seg_s*) next;
+    struct nkit_mpsc_seg_s*       retired_next;   // Consumer-only retire list
+
+    // Item slots, off the producers' counter line
+    alignas(64) _Atomic(void*) slots[MPSC_SEG_SLOTS];
+} nkit_mpsc_seg_t;
+
+struct nkit_mpsc_s {
+    // Producer Cache Line
+    alignas(128) _Atomic(nkit_mpsc_seg_t*) tail;
+
+    // Consumer Cache Line
+    alignas(128) nkit_mpsc_seg_t* head;
+    uint32_t                      head_idx;   // Next slot to read in 'head'
+    nkit_mpsc_seg_t*              retired;    // Drained, waiting for producers to leave
+
+    // Parked Consumer
+    alignas(128) nkit_eventcount_t readable;
+
+    // Read-Only
+    alignas(128) nkit_slab_t* segs;           // Node-local segment free list
+};
+
+_Static_assert(sizeof(nkit_mpsc_seg_t) == MPSC_SEG_BYTES, "segment must fill one page");
+_Static_assert(sizeof(struct nkit_mpsc_s) <= MPSC_SEG_BYTES, "queue must fit in a segment");
+
+// ---------------------------------------------------------------------------
+// Internal Helpers
+// ---------------------------------------------------------------------------
+
+static nkit_mpsc_seg_t* _mpsc_seg_alloc(nkit_mpsc_t* q) {
+    nkit_mpsc_seg_t* seg = nkit_slab_alloc(q->segs);
+    if (!seg) return NULL;
+
+    // 'users' is left alone: a stale producer may still be bumping it
+    // (always back to its previous value)
+    atomic_store_explicit(&seg->claimed, 0, memory_order_relaxed);
+    atomic_store_explicit(&seg->next, NULL, memory_order_relaxed);
+    seg->retired_next = NULL;
+    for (size_t i = 0; i < MPSC_SEG_SLOTS; i++) {
+        atomic_store_explicit(&seg->slots[i], MPSC_EMPTY, memory_order_relaxed);
+    }
+    return seg;
+}
+
+/**
+ * @brief Hand drained segments back to the slab once no producer can
+ * still reach them.
+ *
+ * A producer enters a segment by bumping 'users', then checking that it
+ * is still the tail. Once the tail has moved past a segment and its
+ * 'users' is zero, nobody is inside and nobody new can get in.
+ */
+static void _mpsc_reclaim(nkit_mpsc_t* q) {
+    nkit_mpsc_seg_t** link = &q->retired;
+    nkit_mpsc_seg_t* tail = atomic_load(&q->tail);
+
+    while (*link) {
+        nkit_mpsc_seg_t* seg = *link;
+        if (seg != tail && atomic_load(&seg->users) == 0) {
+            *link = seg->retired_next;
+            nkit_slab_free(q->segs, seg);
+        } else {
+            link = &seg->retired_next;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+nkit_mpsc_t* nkit_mpsc_create(int node_id) {
+    nkit_slab_t* segs = nkit_slab_create_elastic(node_id, MPSC_SEG_BYTES, MPSC_SEG_PER_EXT, 0);
+    if (!segs) return NULL;
+
+    // The queue itself lives in the first slot of its own slab
+    nkit_mpsc_t* q = nkit_slab_alloc(segs);
+    if (!q) {
+        nkit_slab_destroy(segs);
+        return NULL;
+    }
+    q->segs = segs;
+
+    nkit_mpsc_seg_t* first = _mpsc_seg_alloc(q);
+    if (!first) {
+        nkit_slab_destroy(segs);
+        return NULL;
+    }
+    atomic_init(&first->users, 0);
+
+    atomic_init(&q->tail, first);
+    q->head     = first;
+    q->head_idx = 0;
+    q->retired  = NULL;
+    nkit_ec_init(&q->readable);
+    return q;
+}
+
+void nkit_mpsc_destroy(nkit_mpsc_t* q) {
+    if (!q) return;
+
+    // Queue, segments and free list all belong to the slab
+    nkit_slab_destroy(q->segs);
+}
+
+int nkit_mpsc_push(nkit_mpsc_t* q, void* item) {
+    for (;;) {
+        nkit_mpsc_seg_t* seg = atomic_load_explicit(&q->tail, memory_order_acquire);
+
+        // 1. Enter the segment, then make sure it is still the tail
+        atomic_fetch_add(&seg->users, 1);
+        if (atomic_load(&q->tail) != seg) {
+            atomic_fetch_sub_explicit(&seg->users, 1, memory_order_release);
+            continue;
+        }
+
+        // 2. Fast path: claim a slot
+        uint32_t idx = atomic_fetch_add_explicit(&seg->claimed, 1, memory_order_relaxed);
+        if (idx < MPSC_SEG_SLOTS) {
+            atomic_store_explicit(&seg->slots[idx], item, memory_order_release);
+            atomic_fetch_sub_explicit(&seg->users, 1, memory_order_release);
+            return 0;
+        }
+
+        // 3. Segment full: link a fresh one (first producer wins) and
+        //    move the tail forward
+        nkit_mpsc_seg_t* next = atomic_load_explicit(&seg->next, memory_order_acquire);
+        if (!next) {
+            nkit_mpsc_seg_t* fresh = _mpsc_seg_alloc(q);
+            if (!fresh) {
+                atomic_fetch_sub_explicit(&seg->users, 1, memory_order_release);
+                return -1;
+            }
+            if (atomic_compare_exchange_strong(&seg->next, &next, fresh)) {
+                next = fresh;
+            } else {
+                nkit_slab_free(q->segs, fresh);
+            }
+        }
+
+        nkit_mpsc_seg_t* expected = seg;
+        atomic_compare_exchange_strong(&q->tail, &expected, next);
+        atomic_fetch_sub_explicit(&seg->users, 1, memory_order_release);
+    }
+}
+
+void nkit_mpsc_notify(nkit_mpsc_t* q) {
+    nkit_ec_notify(&q->readable);
+}
+
+bool nkit_mpsc_pop(nkit_mpsc_t* q, void** item) {
+    nkit_mpsc_seg_t* seg = q->head;
+
+    if (q->head_idx == MPSC_SEG_SLOTS) {
+        // Drained: step to the next segment, if a producer linked one
+        nkit_mpsc_seg_t* next = atomic_load_explicit(&seg->next, memory_order_acquire);
+        if (!next) return false;
+
+        q->head     = next;
+        q->head_idx = 0;
+        seg->retired_next = q->retired;
+        q->retired  = seg;
+        _mpsc_reclaim(q);
+        seg = next;
+    }
+
+    void* data = atomic_load_explicit(&seg->slots[q->head_idx], memory_order_acquire);
+    if (data == MPSC_EMPTY) return false;
+
+    *item = data;
+    q->head_idx++;
+    return true;
+}
+
+size_t nkit_mpsc_pop_burst(nkit_mpsc_t* q, void** items, size_t n) {
+    size_t got = 0;
+    while (got < n && nkit_mpsc_pop(q, &items[got])) {
+        got++;
+    }
+    return got;
+}
+
+typedef struct {
+    nkit_mpsc_t* q;
+    void**       item;
+} _mpsc_pop_arg_t;
+
+static bool _mpsc_try_pop(void* arg) {
+    _mpsc_pop_arg_t* a = arg;
+    return nkit_mpsc_pop(a->q, a->item);
+}
+
+bool nkit_mpsc_pop_wait(nkit_mpsc_t* q, void** item, int timeout_ms) {
+    _mpsc_pop_arg_t arg = { q, item };
+    return nkit_ec_await(&q->readable, _mpsc_try_pop, &arg, MPSC_WAIT_SPINS, timeout_ms);
+}
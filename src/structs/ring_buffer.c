@@ -3,6 +3,8 @@
 #include <stddef.h>
 #include <stdatomic.h>
 
+#define RING_WAIT_SPINS 256   // Polls before a consumer parks
+
 nkit_ring_t* nkit_ring_create(int node_id, size_t capacity) {
     // 1. Validate power of 2
     if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
@@ -34,6 +36,7 @@ nkit_ring_t* nkit_ring_create(int node_id, size_t capacity) {
 
     atomic_init(&ring->head, 0);
     atomic_init(&ring->tail, 0);
+    nkit_ec_init(&ring->readable);
 
     // 5. CRITICAL: Initialize Sequence Numbers
     // Slot 0 gets seq 0, Slot 1 gets seq 1...
@@ -52,3 +55,18 @@ void nkit_ring_free(nkit_ring_t* ring) {
         nkit_arena_destroy((nkit_arena_t*) ring->_arena);
     }
 }
+
+typedef struct {
+    nkit_ring_t* ring;
+    void**       item;
+} _ring_pop_arg_t;
+
+static bool _ring_try_pop(void* arg) {
+    _ring_pop_arg_t* a = arg;
+    return nkit_ring_pop(a->ring, a->item);
+}
+
+bool nkit_ring_pop_wait(nkit_ring_t* ring, void** item, int timeout_ms) {
+    _ring_pop_arg_t arg = { ring, item };
+    return nkit_ec_await(&ring->readable, _ring_try_pop, &arg, RING_WAIT_SPINS, timeout_ms);
+}
@@ -0,0 +1,45 @@
+#include <numakit/structs/spsc_ring.h>
+#include <numakit/memory.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+nkit_spsc_t* nkit_spsc_create(int node_id, size_t capacity) {
+    // 1. Validate power of 2
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
+        return NULL;
+    }
+
+    // 2. Struct and slots share one node-bound arena
+    size_t struct_sz = sizeof(nkit_spsc_t);
+    size_t slots_sz  = sizeof(void*) * capacity;
+    size_t total_sz  = struct_sz + slots_sz;
+
+    nkit_arena_t* arena = nkit_arena_create(node_id, total_sz);
+    if (!arena) return NULL;
+
+    void* block = nkit_arena_alloc(arena, total_sz);
+    if (!block) {
+        nkit_arena_destroy(arena);
+        return NULL;
+    }
+
+    // 3. Init Struct (both sides start empty, caches included)
+    nkit_spsc_t* ring = (nkit_spsc_t*)block;
+    ring->slots = (void**)((char*)block + struct_sz);
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->_arena = (struct nkit_arena_s*)arena;
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    ring->tail_cache = 0;
+    ring->head_cache = 0;
+
+    return ring;
+}
+
+void nkit_spsc_free(nkit_spsc_t* ring) {
+    if (ring && ring->_arena) {
+        nkit_arena_destroy((nkit_arena_t*)ring->_arena);
+    }
+}
@@ -0,0 +1,102 @@
+#define _GNU_SOURCE
+
+#include <numakit/sync.h>
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+static inline long _nkit_futex(_Atomic(uint32_t)* addr, int op, uint32_t val,
+                               const struct timespec* timeout) {
+    return syscall(SYS_futex, (uint32_t*)addr, op, val, timeout, NULL, 0);
+}
+
+void nkit_ec_init(nkit_eventcount_t* ec) {
+    atomic_init(&ec->seq, 0);
+    atomic_init(&ec->waiters, 0);
+}
+
+uint32_t nkit_ec_prepare_wait(nkit_eventcount_t* ec) {
+    atomic_fetch_add_explicit(&ec->waiters, 1, memory_order_relaxed);
+
+    // Publish 'waiters' before the caller re-checks its condition (pairs
+    // with the fence in nkit_ec_notify): either the notifier sees us, or
+    // we see what it published.
+    atomic_thread_fence(memory_order_seq_cst);
+    return atomic_load_explicit(&ec->seq, memory_order_relaxed);
+}
+
+void nkit_ec_cancel_wait(nkit_eventcount_t* ec) {
+    atomic_fetch_sub_explicit(&ec->waiters, 1, memory_order_relaxed);
+}
+
+int nkit_ec_wait(nkit_eventcount_t* ec, uint32_t key, int timeout_ms) {
+    struct timespec ts;
+    const struct timespec* timeout = NULL;
+    if (timeout_ms >= 0) {
+        ts.tv_sec  = timeout_ms / 1000;
+        ts.tv_nsec = (long)(timeout_ms % 1000) * 1000000L;
+        timeout = &ts;
+    }
+
+    // Fails with EAGAIN right away if 'seq' moved since prepare
+    int rc = 0;
+    if (_nkit_futex(&ec->seq, FUTEX_WAIT_PRIVATE, key, timeout) != 0 && errno == ETIMEDOUT) {
+        rc = -1;
+    }
+
+    atomic_fetch_sub_explicit(&ec->waiters, 1, memory_order_relaxed);
+    return rc;
+}
+
+bool nkit_ec_await(nkit_eventcount_t* ec, bool (*try_fn)(void* arg), void* arg,
+                   int spins, int timeout_ms) {
+    // 1. Short spin: a busy producer usually delivers within a few pauses
+    for (int i = 0; i < spins; i++) {
+        if (try_fn(arg)) return true;
+        nkit_cpu_pause();
+    }
+
+    struct timespec deadline;
+    if (timeout_ms >= 0) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec  += timeout_ms / 1000;
+        deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    // 2. Park until a producer notifies
+    for (;;) {
+        uint32_t key = nkit_ec_prepare_wait(ec);
+        if (try_fn(arg)) {
+            nkit_ec_cancel_wait(ec);
+            return true;
+        }
+
+        int wait_ms = -1;
+        if (timeout_ms >= 0) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            long long left_ns = (long long)(deadline.tv_sec - now.tv_sec) * 1000000000LL
+                              + (deadline.tv_nsec - now.tv_nsec);
+            if (left_ns <= 0) {
+                nkit_ec_cancel_wait(ec);
+                return false;
+            }
+            wait_ms = (int)((left_ns + 999999) / 1000000);
+        }
+        nkit_ec_wait(ec, key, wait_ms);
+    }
+}
+
+void _nkit_ec_wake(nkit_eventcount_t* ec, int count) {
+    atomic_fetch_add_explicit(&ec->seq, 1, memory_order_release);
+    _nkit_futex(&ec->seq, FUTEX_WAKE_PRIVATE, (uint32_t)count, NULL);
+}
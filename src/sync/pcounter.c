@@ -24,8 +24,7 @@ struct nkit_pcounter_s {
     int num_nodes;                  // Snapshot of g_nkit_ctx.num_nodes at creation
 };
 
-nkit_pcounter_t* nkit_pcounter_create(void) {
-    int num_nodes = g_nkit_ctx.num_nodes;
+nkit_pcounter_t* _nkit_pcounter_create_n(int num_nodes) {
     if (num_nodes <= 0) num_nodes = 1;
 
     nkit_pcounter_t* counter = malloc(sizeof(nkit_pcounter_t));
@@ -68,6 +67,10 @@ nkit_pcounter_t* nkit_pcounter_create(void) {
     return counter;
 }
 
+nkit_pcounter_t* nkit_pcounter_create(void) {
+    return _nkit_pcounter_create_n(g_nkit_ctx.num_nodes);
+}
+
 void nkit_pcounter_destroy(nkit_pcounter_t* counter) {
     if (!counter) return;
 
@@ -99,6 +102,14 @@ void nkit_pcounter_add(nkit_pcounter_t* counter, int64_t value) {
                               memory_order_relaxed);
 }
 
+void _nkit_pcounter_add_slot(nkit_pcounter_t* counter, int slot, int64_t value) {
+    if (slot < 0 || slot >= counter->num_nodes) {
+        slot = 0;
+    }
+    atomic_fetch_add_explicit(&counter->slots[slot]->value, value,
+                              memory_order_relaxed);
+}
+
 void nkit_pcounter_inc(nkit_pcounter_t* counter) {
     nkit_pcounter_add(counter, 1);
 }
@@ -116,6 +127,12 @@ int64_t nkit_pcounter_read(nkit_pcounter_t* counter) {
     return sum;
 }
 
+int64_t _nkit_pcounter_read_slot(nkit_pcounter_t* counter, int slot) {
+    if (slot < 0 || slot >= counter->num_nodes) return 0;
+    return atomic_load_explicit(&counter->slots[slot]->value,
+                                memory_order_acquire);
+}
+
 void nkit_pcounter_reset(nkit_pcounter_t* counter) {
     for (int i = 0; i < counter->num_nodes; i++) {
         atomic_store_explicit(&counter->slots[i]->value, 0,
@@ -122,6 +122,42 @@ static void* nkit_consumer(__attribute__((unused)) void* arg) {
     return NULL;
 }
 
+// -----------------------------------------------------------------------------
+// LibNumaKit: Bulk Push / Pop
+// -----------------------------------------------------------------------------
+
+static void* nkit_bulk_producer(__attribute__((unused)) void* arg) {
+    nkit_bind_thread(g_producer_node);
+
+    void* batch[BATCH_SIZE];
+    for (size_t i = 0; i < NUM_MSGS; i += BATCH_SIZE) {
+        for (size_t j = 0; j < BATCH_SIZE; j++) {
+            batch[j] = (void*)(uintptr_t)(i + j);
+        }
+        while (nkit_ring_push_bulk(g_nkit_ring, batch, BATCH_SIZE) == 0) {
+            nkit_cpu_pause();
+        }
+    }
+    return NULL;
+}
+
+static void* nkit_bulk_consumer(__attribute__((unused)) void* arg) {
+    nkit_bind_thread(g_consumer_node);
+
+    size_t received = 0;
+    void* batch[BATCH_SIZE];
+
+    while (received < NUM_MSGS) {
+        size_t got = nkit_ring_pop_burst(g_nkit_ring, batch, BATCH_SIZE);
+        if (got) {
+            received += got;
+        } else {
+            nkit_cpu_pause();
+        }
+    }
+    return NULL;
+}
+
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
@@ -197,8 +233,22 @@ int bench_00_throughput(__attribute__((unused)) int argc, __attribute__((unused)
     printf("  -> Time: %.4f s\n", end - start);
     printf("  -> Ops:  %.2f M/sec\n", nkit_ops / 1e6);
 
+    // 3. Run Numakit, batched
+    printf("\n[LibNumaKit] Bulk Push / Burst Pop (%d per op)...\n", BATCH_SIZE);
+
+    start = get_time();
+    pthread_create(&p, NULL, nkit_bulk_producer, NULL);
+    pthread_create(&c, NULL, nkit_bulk_consumer, NULL);
+    pthread_join(p, NULL);
+    pthread_join(c, NULL);
+    end = get_time();
+
+    double bulk_ops = NUM_MSGS / (end - start);
+    printf("  -> Time: %.4f s\n", end - start);
+    printf("  -> Ops:  %.2f M/sec\n", bulk_ops / 1e6);
+
     printf("\n---------------------------------------------------------\n");
-    printf(" SPEEDUP: %.2fx\n", nkit_ops / baseline_ops);
+    printf(" SPEEDUP: %.2fx (bulk: %.2fx)\n", nkit_ops / baseline_ops, bulk_ops / baseline_ops);
     printf("---------------------------------------------------------\n");
 
     nkit_ring_free(g_nkit_ring);
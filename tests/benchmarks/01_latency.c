@@ -136,6 +136,51 @@ static void* nkit_thread_b(__attribute__((unused)) void* arg) {
     return NULL;
 }
 
+// -----------------------------------------------------------------------------
+// LibNumaKit: SPSC Ring (Ping-Pong)
+// -----------------------------------------------------------------------------
+
+static nkit_spsc_t* g_spsc_a_to_b;
+static nkit_spsc_t* g_spsc_b_to_a;
+
+static void* spsc_thread_a(__attribute__((unused)) void* arg) {
+    nkit_bind_thread(g_node_a);
+    long checksum = 0;
+    void* data;
+
+    for (long i = 0; i < NUM_ROUNDTRIPS; i++) {
+        while (!nkit_spsc_push(g_spsc_a_to_b, (void*)i)) {
+            nkit_cpu_pause();
+        }
+        while (!nkit_spsc_pop(g_spsc_b_to_a, &data)) {
+            nkit_cpu_pause();
+        }
+
+        long reply = (long)data;
+        if (reply != i) {
+            fprintf(stderr, "FATAL: SPSC mismatch! Sent %ld, got %ld\n", i, reply);
+            exit(1);
+        }
+        checksum += reply;
+    }
+    return (void*)checksum;
+}
+
+static void* spsc_thread_b(__attribute__((unused)) void* arg) {
+    nkit_bind_thread(g_node_b);
+    void* data;
+
+    for (long i = 0; i < NUM_ROUNDTRIPS; i++) {
+        while (!nkit_spsc_pop(g_spsc_a_to_b, &data)) {
+            nkit_cpu_pause();
+        }
+        while (!nkit_spsc_push(g_spsc_b_to_a, data)) {
+            nkit_cpu_pause();
+        }
+    }
+    return NULL;
+}
+
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
@@ -217,10 +262,39 @@ int bench_01_latency(__attribute__((unused)) int argc, __attribute__((unused)) c
     double latency_nkit = (time_nkit / NUM_ROUNDTRIPS) * 1e9;
     printf("  -> Avg RTT:  %.0f ns\n", latency_nkit);
 
+    // 3. LibNumaKit SPSC
+    printf("\n[LibNumaKit] SPSC Ring...\n");
+
+    g_spsc_a_to_b = nkit_spsc_create(g_node_b, 4096);
+    g_spsc_b_to_a = nkit_spsc_create(g_node_a, 4096);
+
+    if (!g_spsc_a_to_b || !g_spsc_b_to_a) {
+        printf("Failed to create SPSC rings\n");
+        return 1;
+    }
+
+    start = get_time();
+    pthread_create(&t1, NULL, spsc_thread_a, NULL);
+    pthread_create(&t2, NULL, spsc_thread_b, NULL);
+
+    pthread_join(t1, &res1);
+    pthread_join(t2, NULL);
+    end = get_time();
+
+    long spsc_check = (long)res1;
+    printf("  -> Checksum: %ld (Expected: %ld) %s\n", spsc_check, (long)NUM_ROUNDTRIPS*(NUM_ROUNDTRIPS-1)/2, 
+           (spsc_check == (long)NUM_ROUNDTRIPS*(NUM_ROUNDTRIPS-1)/2) ? "OK" : "FAIL");
+
+    double latency_spsc = ((end - start) / NUM_ROUNDTRIPS) * 1e9;
+    printf("  -> Avg RTT:  %.0f ns\n", latency_spsc);
+
     printf("\n---------------------------------------------------------\n");
-    printf(" LATENCY REDUCTION: %.1fx Lower\n", latency_std / latency_nkit);
+    printf(" LATENCY REDUCTION: %.1fx Lower (SPSC: %.1fx)\n",
+           latency_std / latency_nkit, latency_std / latency_spsc);
     printf("---------------------------------------------------------\n");
 
+    nkit_spsc_free(g_spsc_a_to_b);
+    nkit_spsc_free(g_spsc_b_to_a);
     nkit_teardown();
     return 0;
 }
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <stdatomic.h>
 #include <unistd.h>
+#include <sys/resource.h>
 #include <numakit/numakit.h>
 
 #include "unit.h"
@@ -51,6 +52,24 @@ int test_02_task_pool(void) {
     assert(atomic_load(&g_task_counter) == num_tasks);
     printf("  -> Executed %d tasks successfully.\n", num_tasks);
 
+    // Idle workers park until a submit wakes them: no periodic wake-ups
+    usleep(300 * 1000);
+    struct rusage before, after;
+    getrusage(RUSAGE_SELF, &before);
+    usleep(200 * 1000);
+    getrusage(RUSAGE_SELF, &after);
+    long wakeups = after.ru_nvcsw - before.ru_nvcsw;
+    assert(wakeups < 20);
+
+    // ...and a submit still reaches a parked worker
+    assert(nkit_pool_submit_to_node(pool, 0, sample_task, (void*)(intptr_t)1) == 0);
+    timeouts = 0;
+    while (atomic_load(&g_task_counter) < num_tasks + 1) {
+        usleep(1000);
+        assert(++timeouts < 5000);
+    }
+    printf("  -> Parked workers: %ld wake-ups in 200ms idle.\n", wakeups);
+
     nkit_pool_destroy(pool);
     nkit_teardown(); // Clean up
     printf("[UNIT] Task Pool Test Passed.\n");
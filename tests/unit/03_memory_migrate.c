@@ -1,12 +1,144 @@
 #define _GNU_SOURCE
 
 #include <assert.h>
+#include <errno.h>
 #include <numakit/numakit.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include "unit.h"
 
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void test_migrate_async(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t size = 4 * 1024 * 1024; // 4MB
+    char *buffer = aligned_alloc(page, size);
+    assert(buffer != NULL);
+    memset(buffer, 1, size);
+
+    // Small batches and a 100 MB/s cap: 4MB must take at least ~40ms
+    nkit_migrator_attr_t attr = { .batch_pages = 64, .rate_limit_mbps = 100.0 };
+    nkit_migrator_t *mig = nkit_migrator_create(&attr);
+    if (!mig) {
+        printf("  [Warning] Migration service unavailable (no NUMA support?)\n");
+        free(buffer);
+        return;
+    }
+
+    double start = now_ms();
+    nkit_migration_t *m = nkit_migrate_async(mig, buffer, size, 0);
+    assert(m != NULL);
+
+    long missed = nkit_migration_wait(m);
+    double elapsed = now_ms() - start;
+    assert(missed >= 0);
+    assert(nkit_migration_done(m));
+    assert(elapsed >= 35.0);
+
+    const int *status = NULL;
+    assert(nkit_migration_status(m, &status) == (long)(size / page));
+    size_t on_target = 0;
+    for (size_t i = 0; i < size / page; i++) on_target += status[i] == 0;
+    assert(on_target == size / page - (size_t)missed);
+    assert(nkit_migration_bytes_moved(m) == on_target * page);
+
+    if (missed == 0) {
+        printf("  -> Async migration moved 4MB to Node 0 in %.1f ms (rate limited).\n", elapsed);
+    } else {
+        printf("  [Warning] %ld pages not migrated (first status %d)\n", missed, status[0]);
+    }
+    nkit_migration_free(m);
+
+    // Several queued requests complete in order; destroy drains the queue
+    nkit_migration_t *q[4];
+    for (int i = 0; i < 4; i++) {
+        q[i] = nkit_migrate_async(mig, buffer + i * (size / 4), size / 4, 0);
+        assert(q[i] != NULL);
+    }
+    nkit_migrator_destroy(mig);
+    for (int i = 0; i < 4; i++) {
+        assert(nkit_migration_done(q[i]));
+        nkit_migration_free(q[i]);
+    }
+
+    assert(nkit_migrate_async(NULL, buffer, size, 0) == NULL);
+    assert(nkit_migration_wait(NULL) == -1);
+    assert(nkit_migration_status(NULL, NULL) == -1);
+
+    free(buffer);
+}
+
+static void test_memory_residency(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t size = 4 * 1024 * 1024;
+    size_t npages = size / page;
+    char *buffer = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    assert(buffer != MAP_FAILED);
+
+    // Touch the first half only
+    memset(buffer, 1, size / 2);
+
+    nkit_residency_t r;
+    assert(nkit_memory_residency(buffer, size, &r, 0) == 0);
+    assert(r.pages == npages);
+    assert(r.per_node[0] == npages / 2);
+    assert(r.not_present == npages / 2);
+    assert(r.dominant_node == 0);
+
+    // A hot range is served from the cache until it ages out or is invalidated
+    memset(buffer + size / 2, 1, size / 4);
+    nkit_residency_t cached;
+    assert(nkit_memory_residency(buffer, size, &cached, 60000) == 0);
+    assert(cached.sampled_ns == r.sampled_ns);
+    assert(cached.per_node[0] == npages / 2);
+
+    nkit_memory_residency_invalidate(buffer + size - 1, 1);
+    assert(nkit_memory_residency(buffer, size, &cached, 60000) == 0);
+    assert(cached.sampled_ns > r.sampled_ns);
+    assert(cached.per_node[0] == npages / 2 + npages / 4);
+
+    // Ranges that share a base but not a length get their own slots
+    nkit_residency_t by_len[8];
+    for (size_t i = 0; i < 8; i++) {
+        assert(nkit_memory_residency(buffer, (i + 1) * page, &by_len[i], 0) == 0);
+    }
+    int hits = 0;
+    for (size_t i = 0; i < 8; i++) {
+        nkit_residency_t again;
+        assert(nkit_memory_residency(buffer, (i + 1) * page, &again, 60000) == 0);
+        hits += again.sampled_ns == by_len[i].sampled_ns;
+    }
+    assert(hits > 1);
+
+    // Migrations through libnumakit drop the cached result
+    nkit_memory_migrate(buffer, size, 0);
+    assert(nkit_memory_residency(buffer, size, &r, 60000) == 0);
+    assert(r.sampled_ns > cached.sampled_ns);
+
+    // Page nodes: absent pages are -ENOENT with or without NUMA support
+    int nodes[2];
+    assert(nkit_memory_page_nodes(buffer, 2 * page, nodes) == 2);
+    assert(nodes[0] >= 0 && nodes[1] >= 0);
+    assert(nkit_memory_page_nodes(buffer + size - 2 * page, 2 * page, nodes) == 2);
+    assert(nodes[0] == -ENOENT && nodes[1] == -ENOENT);
+
+    assert(nkit_memory_residency(NULL, size, &r, 0) == -1);
+    assert(nkit_memory_residency(buffer, 0, &r, 0) == -1);
+
+    munmap(buffer, size);
+    printf("  -> Residency histogram and cache: OK\n");
+}
+
 int test_03_memory_migrate(void) {
     printf("[UNIT] Memory Migration Test Started...\n");
 
@@ -31,6 +163,10 @@ int test_03_memory_migrate(void) {
     }
 
     free(buffer);
+
+    test_migrate_async();
+    test_memory_residency();
+
     printf("[UNIT] Memory Migration Test Passed.\n");
     return 0;
 }
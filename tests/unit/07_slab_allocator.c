@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <string.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <numakit/numakit.h>
 #include "unit.h"
@@ -228,6 +229,104 @@ static void test_slab_null_safety(void) {
     printf("  [Check] NULL Safety: OK\n");
 }
 
+// ============================================================================
+// Test 9: Elastic Growth, Shrink and Re-Activation
+// ============================================================================
+static void test_slab_elastic(void) {
+    size_t ext_cap = 16, max_ext = 4;
+    nkit_slab_t *slab = nkit_slab_create_elastic(0, 64, ext_cap, max_ext);
+    assert(slab != NULL);
+    assert(nkit_slab_capacity(slab) == ext_cap);
+
+    // Grows extent by extent up to the limit
+    void *ptrs[64];
+    for (size_t i = 0; i < ext_cap * max_ext; i++) {
+        ptrs[i] = nkit_slab_alloc(slab);
+        assert(ptrs[i] != NULL);
+        memset(ptrs[i], (int)i, 64);
+    }
+    assert(nkit_slab_capacity(slab) == ext_cap * max_ext);
+    assert(nkit_slab_available(slab) == 0);
+    assert(nkit_slab_alloc(slab) == NULL);
+
+    // Busy extents are never released
+    assert(nkit_slab_shrink(slab) == 0);
+
+    for (size_t i = 0; i < ext_cap * max_ext; i++) {
+        nkit_slab_free(slab, ptrs[i]);
+    }
+    assert(nkit_slab_available(slab) == ext_cap * max_ext);
+
+    // Idle extents (all but the first) go back to the OS
+    assert(nkit_slab_shrink(slab) == max_ext - 1);
+    assert(nkit_slab_capacity(slab) == ext_cap);
+    assert(nkit_slab_available(slab) == ext_cap);
+
+    // Released extents are re-activated on demand (bulk path included)
+    void *batch[64];
+    size_t got = 0;
+    while (got < ext_cap * max_ext) {
+        size_t n = nkit_slab_alloc_bulk(slab, &batch[got], ext_cap * max_ext - got);
+        assert(n > 0);
+        got += n;
+    }
+    for (size_t i = 0; i < got; i++) {
+        memset(batch[i], 0x5A, 64);
+    }
+    assert(nkit_slab_capacity(slab) == ext_cap * max_ext);
+    nkit_slab_free_bulk(slab, batch, got);
+    assert(nkit_slab_available(slab) == ext_cap * max_ext);
+
+    // Fixed slabs never shrink
+    nkit_slab_t *fixed = nkit_slab_create(0, 64, 16);
+    assert(fixed != NULL);
+    assert(nkit_slab_shrink(fixed) == 0);
+    nkit_slab_destroy(fixed);
+
+    nkit_slab_destroy(slab);
+    printf("  [Check] Elastic Grow/Shrink: OK\n");
+}
+
+// ============================================================================
+// Test 10: Unbounded Slabs Double Their Extents
+// ============================================================================
+static void test_slab_unbounded(void) {
+    nkit_slab_t *slab = nkit_slab_create_elastic(0, 64, 2, 0);
+    assert(slab != NULL);
+    assert(nkit_slab_capacity(slab) == 2);
+
+    // Each growth step doubles: 2, then 2 + 4, then 2 + 4 + 8
+    void *ptrs[14];
+    for (int i = 0; i < 3; i++) ptrs[i] = nkit_slab_alloc(slab);
+    assert(nkit_slab_capacity(slab) == 6);
+    for (int i = 3; i < 7; i++) ptrs[i] = nkit_slab_alloc(slab);
+    assert(nkit_slab_capacity(slab) == 14);
+    for (int i = 0; i < 7; i++) {
+        assert(ptrs[i] != NULL);
+        nkit_slab_free(slab, ptrs[i]);
+    }
+
+    // Far past NKIT_SLAB_MAX_EXTENTS extents of the first size
+    size_t n = (size_t)NKIT_SLAB_MAX_EXTENTS * 2 * 16;
+    void **many = malloc(n * sizeof(void *));
+    assert(many != NULL);
+    for (size_t i = 0; i < n; i++) {
+        many[i] = nkit_slab_alloc(slab);
+        assert(many[i] != NULL);
+        memset(many[i], 0x3C, 64);
+    }
+    nkit_slab_free_bulk(slab, many, n);
+    assert(nkit_slab_available(slab) == nkit_slab_capacity(slab));
+
+    // Idle doubled extents go back like any other
+    assert(nkit_slab_shrink(slab) > 0);
+    assert(nkit_slab_capacity(slab) == 2);
+
+    free(many);
+    nkit_slab_destroy(slab);
+    printf("  [Check] Unbounded Doubling Growth: OK\n");
+}
+
 // ============================================================================
 // Entry Point
 // ============================================================================
@@ -242,6 +341,8 @@ int test_07_slab_allocator(void) {
     test_slab_write_stress();
     test_slab_multithread();
     test_slab_null_safety();
+    test_slab_elastic();
+    test_slab_unbounded();
 
     printf("[UNIT] Slab Allocator Test Passed\n");
     return 0;
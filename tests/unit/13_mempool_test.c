@@ -1,9 +1,450 @@
 #include <stdio.h>
 #include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <numakit/memory.h>
 #include <numakit/numakit.h>
 #include "unit.h"
 
+// Objects per size class per node (mirrors the pool's slab capacity)
+#define POOL_SLAB_CAPACITY 1024
+
+static void test_mempool_magazine_reuse(nkit_mempool_t* pool) {
+    // A freed block is cached by the thread and handed back first (LIFO)
+    void* a = nkit_mempool_alloc(pool, 100);
+    assert(a != NULL);
+    nkit_mempool_free(pool, a);
+    void* b = nkit_mempool_alloc(pool, 110); // Same 112B class
+    assert(b == a);
+    nkit_mempool_free(pool, b);
+
+    // Churn well past the magazine size to exercise refill/flush batches
+    void* ptrs[300];
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < 300; i++) {
+            ptrs[i] = nkit_mempool_alloc(pool, 64);
+            assert(ptrs[i] != NULL);
+            ((char*)ptrs[i])[63] = (char)i;
+        }
+        for (int i = 0; i < 300; i++) {
+            assert(((char*)ptrs[i])[63] == (char)i);
+            nkit_mempool_free(pool, ptrs[i]);
+        }
+    }
+
+    nkit_mempool_flush(pool);
+    printf("  [+] Magazine reuse and batch refill/flush OK.\n");
+}
+
+#define TC_THREADS 4
+
+static void* tcache_worker(void* arg) {
+    nkit_mempool_t* pool = (nkit_mempool_t*)arg;
+    void* ptrs[200];
+    for (int i = 0; i < 200; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, 32);
+        assert(ptrs[i] != NULL);
+    }
+    for (int i = 0; i < 200; i++) {
+        nkit_mempool_free(pool, ptrs[i]);
+    }
+    // Thread exit must flush the magazines back to the slabs
+    return NULL;
+}
+
+static void test_mempool_thread_exit_flush(nkit_mempool_t* pool) {
+    pthread_t threads[TC_THREADS];
+    for (int i = 0; i < TC_THREADS; i++) {
+        assert(pthread_create(&threads[i], NULL, tcache_worker, pool) == 0);
+    }
+    for (int i = 0; i < TC_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // Nothing may be stranded in dead threads' caches: the full class
+    // capacity must still be allocatable from this thread.
+    static void* all[POOL_SLAB_CAPACITY];
+    for (int i = 0; i < POOL_SLAB_CAPACITY; i++) {
+        all[i] = nkit_mempool_alloc(pool, 32);
+        assert(all[i] != NULL);
+    }
+    for (int i = 0; i < POOL_SLAB_CAPACITY; i++) {
+        nkit_mempool_free(pool, all[i]);
+    }
+    nkit_mempool_flush(pool);
+    printf("  [+] Thread-exit cache flush OK.\n");
+}
+
+// Runs after the pool's own tcache destructor (keys are destroyed in
+// creation order): the thread's cache is already gone.
+static pthread_key_t late_key;
+
+static void late_destructor(void* arg) {
+    nkit_mempool_t* pool = (nkit_mempool_t*)arg;
+    void* ptrs[100];
+    for (int i = 0; i < 100; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, 640);
+        assert(ptrs[i] != NULL);
+    }
+    for (int i = 0; i < 100; i++) {
+        nkit_mempool_free(pool, ptrs[i]);
+    }
+}
+
+static void* late_worker(void* arg) {
+    nkit_mempool_free(arg, nkit_mempool_alloc(arg, 640));
+    pthread_setspecific(late_key, arg);
+    return NULL;
+}
+
+static void test_mempool_late_thread_free(nkit_mempool_t* pool) {
+    assert(pthread_key_create(&late_key, late_destructor) == 0);
+    pthread_t thread;
+    assert(pthread_create(&thread, NULL, late_worker, pool) == 0);
+    pthread_join(thread, NULL);
+    pthread_key_delete(late_key);
+
+    // Blocks freed by the late destructor went straight back to the slab
+    static void* all[POOL_SLAB_CAPACITY];
+    for (int i = 0; i < POOL_SLAB_CAPACITY; i++) {
+        all[i] = nkit_mempool_alloc(pool, 640);
+        assert(all[i] != NULL);
+    }
+    for (int i = 0; i < POOL_SLAB_CAPACITY; i++) {
+        nkit_mempool_free(pool, all[i]);
+    }
+    nkit_mempool_flush(pool);
+    printf("  [+] Frees after thread-exit flush OK.\n");
+}
+
+static void test_mempool_aligned(nkit_mempool_t* pool) {
+    // Class alignment: 80B has 16B natural alignment, 64B asks for a
+    // naturally 64-aligned class instead
+    void* p = nkit_mempool_alloc_aligned(pool, 80, 64);
+    assert(p != NULL && ((uintptr_t)p & 63) == 0);
+    assert(nkit_mempool_usable_size(pool, p) >= 80);
+    nkit_mempool_free(pool, p);
+
+    // Beyond 64B: still a power-of-two size class, not a large span
+    p = nkit_mempool_alloc_aligned(pool, 32, 128);
+    assert(p != NULL && ((uintptr_t)p & 127) == 0);
+    assert(nkit_mempool_usable_size(pool, p) == 128);
+    nkit_mempool_free(pool, p);
+
+    void* many[64];
+    for (int i = 0; i < 64; i++) {
+        many[i] = nkit_mempool_alloc_aligned(pool, 100, 1024);
+        assert(many[i] != NULL && ((uintptr_t)many[i] & 1023) == 0);
+        assert(nkit_mempool_usable_size(pool, many[i]) == 1024);
+        memset(many[i], 0xab, 100);
+    }
+    for (int i = 0; i < 64; i++) nkit_mempool_free(pool, many[i]);
+
+    // Past the biggest class: large tier, block inside the first page
+    p = nkit_mempool_alloc_aligned(pool, 20000, 2048);
+    assert(p != NULL && ((uintptr_t)p & 2047) == 0);
+    assert(nkit_mempool_usable_size(pool, p) >= 20000);
+    nkit_mempool_free(pool, p);
+
+    assert(nkit_mempool_alloc_aligned(pool, 100, 48) == NULL);   // Not a power of two
+    assert(nkit_mempool_alloc_aligned(pool, 100, 4096) == NULL); // Past the first page
+
+    // Usable sizes: the class, or the rest of the span; 0 for foreign memory
+    p = nkit_mempool_alloc(pool, 100);
+    assert(nkit_mempool_usable_size(pool, p) == nkit_mempool_class_size(pool, 100));
+    nkit_mempool_free(pool, p);
+    p = nkit_mempool_alloc(pool, 100 * 1024);
+    assert(nkit_mempool_usable_size(pool, p) == nkit_mempool_class_size(pool, 100 * 1024));
+    nkit_mempool_free(pool, p);
+
+    int local;
+    assert(nkit_mempool_usable_size(pool, &local) == 0);
+    nkit_slab_t* slab = nkit_slab_create(0, 64, 16);
+    void* obj = nkit_slab_alloc(slab);
+    assert(nkit_mempool_usable_size(pool, obj) == 0);
+    nkit_slab_free(slab, obj);
+    nkit_slab_destroy(slab);
+
+    printf("  [+] Aligned allocation / usable size OK.\n");
+}
+
+static void test_mempool_header_free(void) {
+    // Fresh pool so the magazines are filled from untouched extents
+    nkit_mempool_t* pool = nkit_mempool_create();
+    assert(pool != NULL);
+
+    // No per-object header: neighbouring 32B blocks are 32 bytes apart
+    void* a = nkit_mempool_alloc(pool, 32);
+    void* b = nkit_mempool_alloc(pool, 32);
+    assert(a != NULL && b != NULL);
+    intptr_t gap = (char*)a - (char*)b;
+    assert(gap == 32 || gap == -32);
+    assert(((uintptr_t)a & 31) == 0);
+
+    // Classes keep their natural alignment (capped at a cache line)
+    void* c = nkit_mempool_alloc(pool, 64);
+    void* d = nkit_mempool_alloc(pool, 4096);
+    assert(((uintptr_t)c & 63) == 0);
+    assert(((uintptr_t)d & 63) == 0);
+
+    // The whole block is usable (nothing hidden in front of it)
+    memset(a, 0xAA, 32);
+    memset(b, 0xBB, 32);
+    assert(((unsigned char*)a)[0] == 0xAA && ((unsigned char*)b)[31] == 0xBB);
+
+    nkit_mempool_free(pool, a);
+    nkit_mempool_free(pool, b);
+    nkit_mempool_free(pool, c);
+    nkit_mempool_free(pool, d);
+
+    // Pointers the pool never handed out are ignored
+    static char foreign[64];
+    nkit_mempool_free(pool, foreign);
+
+    nkit_mempool_destroy(pool);
+    printf("  [+] Header-free blocks OK.\n");
+}
+
+static void test_mempool_size_classes(nkit_mempool_t* pool) {
+    // Default set: 16B steps up to 128B, then quarter-power steps
+    assert(nkit_mempool_class_size(pool, 1) == 16);
+    assert(nkit_mempool_class_size(pool, 17) == 32);
+    assert(nkit_mempool_class_size(pool, 100) == 112);
+    assert(nkit_mempool_class_size(pool, 129) == 160);
+    assert(nkit_mempool_class_size(pool, 161) == 192);
+    assert(nkit_mempool_class_size(pool, 257) == 320);
+    assert(nkit_mempool_class_size(pool, 1025) == 1280);
+    assert(nkit_mempool_class_size(pool, 16384) == 16384);
+    assert(nkit_mempool_class_size(pool, 16385) > 16384); // Large tier
+
+    // Every small size lands in a class at most 25% bigger (20% waste)
+    for (size_t size = 129; size <= 16384; size++) {
+        size_t cls = nkit_mempool_class_size(pool, size);
+        assert(cls >= size);
+        assert(cls * 4 <= size * 5 + 4 * 16);
+    }
+
+    // Custom class set matching the application's dominant objects
+    const size_t custom[] = { 24, 72, 200, 1000 };
+    nkit_mempool_t* cp = nkit_mempool_create_ex(custom, 4);
+    assert(cp != NULL);
+    assert(nkit_mempool_class_size(cp, 8) == 32);     // 24 rounded to 16B
+    assert(nkit_mempool_class_size(cp, 72) == 80);
+    assert(nkit_mempool_class_size(cp, 81) == 208);
+    assert(nkit_mempool_class_size(cp, 1000) == 1008);
+    assert(nkit_mempool_class_size(cp, 1009) > 1008); // Large tier
+
+    void* objs[200];
+    for (int i = 0; i < 200; i++) {
+        objs[i] = nkit_mempool_alloc(cp, 72);
+        assert(objs[i] != NULL);
+        assert(((uintptr_t)objs[i] & 15) == 0);
+        memset(objs[i], i, 72);
+    }
+    for (int i = 0; i < 200; i++) {
+        assert(((unsigned char*)objs[i])[71] == (unsigned char)i);
+        nkit_mempool_free(cp, objs[i]);
+    }
+    void* big = nkit_mempool_alloc(cp, 2000);
+    assert(big != NULL);
+    nkit_mempool_free(cp, big);
+    nkit_mempool_destroy(cp);
+
+    // Invalid sets are rejected
+    const size_t unsorted[] = { 64, 32 };
+    const size_t dup[] = { 20, 32 };   // Both round to 32
+    const size_t huge[] = { 32, 32768 };
+    assert(nkit_mempool_create_ex(unsorted, 2) == NULL);
+    assert(nkit_mempool_create_ex(dup, 2) == NULL);
+    assert(nkit_mempool_create_ex(huge, 2) == NULL);
+    assert(nkit_mempool_create_ex(custom, 0) == NULL);
+    assert(nkit_mempool_create_ex(NULL, 4) == NULL);
+
+    printf("  [+] Size classes and custom class sets OK.\n");
+}
+
+static void test_mempool_large(nkit_mempool_t* pool) {
+    const size_t sizes[] = { 16385, 32768, 64 * 1024, 1024 * 1024, 8 * 1024 * 1024 };
+    enum { NS = sizeof(sizes) / sizeof(sizes[0]) };
+    void* ptrs[NS];
+
+    for (int i = 0; i < NS; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, sizes[i]);
+        assert(ptrs[i] != NULL);
+        assert(((uintptr_t)ptrs[i] & 63) == 0);
+        memset(ptrs[i], 0x40 + i, sizes[i]);
+    }
+    for (int i = 0; i < NS; i++) {
+        unsigned char* b = (unsigned char*)ptrs[i];
+        assert(b[0] == 0x40 + i && b[sizes[i] - 1] == 0x40 + i);
+    }
+    for (int i = 0; i < NS; i++) {
+        nkit_mempool_free(pool, ptrs[i]);
+    }
+
+    // Freed spans are cached and handed out again
+    void* a = nkit_mempool_alloc(pool, 64 * 1024);
+    assert(a != NULL);
+    nkit_mempool_free(pool, a);
+    void* b = nkit_mempool_alloc(pool, 64 * 1024);
+    assert(b == a);
+    nkit_mempool_free(pool, b);
+
+    // Many live spans of mixed sizes, freed out of order (coalescing)
+    enum { NL = 64 };
+    void* live[NL];
+    for (int i = 0; i < NL; i++) {
+        live[i] = nkit_mempool_alloc(pool, 20000 + (size_t)i * 7000);
+        assert(live[i] != NULL);
+        ((char*)live[i])[0] = (char)i;
+    }
+    for (int i = 0; i < NL; i += 2) nkit_mempool_free(pool, live[i]);
+    for (int i = 1; i < NL; i += 2) nkit_mempool_free(pool, live[i]);
+
+    void* big = nkit_mempool_alloc(pool, 4 * 1024 * 1024);
+    assert(big != NULL);
+    memset(big, 0x7F, 4 * 1024 * 1024);
+    nkit_mempool_free(pool, big);
+
+    // Overflowing the warm cache purges spans, but purged bytes no longer
+    // count against it: a later free keeps its pages again
+    enum { NB = 5 };
+    const size_t block = 16 * 1024 * 1024;
+    void* blocks[NB];
+    for (int i = 0; i < NB; i++) {
+        blocks[i] = nkit_mempool_alloc(pool, block);
+        assert(blocks[i] != NULL);
+        memset(blocks[i], 0x11, block);
+    }
+    for (int i = 0; i < NB; i++) nkit_mempool_free(pool, blocks[i]);
+    nkit_mempool_trim(pool);
+
+    const size_t warm_bytes = 1024 * 1024;
+    char* warm = nkit_mempool_alloc(pool, warm_bytes);
+    assert(warm != NULL);
+    memset(warm, 0x22, warm_bytes);
+    nkit_mempool_free(pool, warm);
+
+    char* body = (char*)(((uintptr_t)warm + 4095) & ~(uintptr_t)4095);
+    unsigned char vec[256];
+    size_t body_pages = (warm_bytes - (size_t)(body - warm)) / 4096;
+    assert(mincore(body, body_pages * 4096, vec) == 0);
+    for (size_t i = 0; i < body_pages; i++) assert(vec[i] & 1);
+
+    printf("  [+] Large-object tier OK.\n");
+}
+
+typedef struct {
+    nkit_mempool_t* pool;
+    void**          ptrs;
+    int             count;
+} remote_args_t;
+
+static void* remote_free_worker(void* arg) {
+    remote_args_t* a = (remote_args_t*)arg;
+    nkit_pin_thread_to_node(1);
+    for (int i = 0; i < a->count; i++) {
+        nkit_mempool_free(a->pool, a->ptrs[i]);
+    }
+    // Post the partial batch before the counter is read
+    nkit_mempool_flush(a->pool);
+    return NULL;
+}
+
+static void test_mempool_remote_free(nkit_mempool_t* pool) {
+    assert(nkit_mempool_remote_frees(NULL) == 0);
+
+    // Local traffic never counts as remote
+    uint64_t before = nkit_mempool_remote_frees(pool);
+    void* p = nkit_mempool_alloc(pool, 48);
+    assert(p != NULL);
+    nkit_mempool_free(pool, p);
+    nkit_mempool_flush(pool);
+    assert(nkit_mempool_remote_frees(pool) == before);
+
+    if (nkit_topo_num_nodes() < 2) {
+        printf("  [~] Remote free inbox skipped (single node).\n");
+        return;
+    }
+
+    // Node 0 allocates, a thread on node 1 frees: every free is remote
+    enum { N = 100 };
+    static void* ptrs[N];
+    nkit_pin_thread_to_node(0);
+    for (int i = 0; i < N; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, 48);
+        assert(ptrs[i] != NULL);
+    }
+    nkit_mempool_flush(pool);
+
+    remote_args_t args = { pool, ptrs, N };
+    pthread_t t;
+    assert(pthread_create(&t, NULL, remote_free_worker, &args) == 0);
+    pthread_join(t, NULL);
+    assert(nkit_mempool_remote_frees(pool) == before + N);
+
+    // The owner drains its inbox on the next refill
+    void* again = nkit_mempool_alloc(pool, 48);
+    assert(again != NULL);
+    nkit_mempool_free(pool, again);
+    nkit_mempool_flush(pool);
+    nkit_unbind_thread();
+    printf("  [+] Remote free inbox OK.\n");
+}
+
+static void test_mempool_elastic_trim(nkit_mempool_t* pool) {
+    // Well past one extent per class: the local slab must grow (each
+    // extent doubling the last, so 1 + 2 + 4 first extents and more)
+    enum { N = 8 * POOL_SLAB_CAPACITY };
+    static void* ptrs[N];
+    for (int i = 0; i < N; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, 256);
+        assert(ptrs[i] != NULL);
+        ((char*)ptrs[i])[255] = 1;
+    }
+    for (int i = 0; i < N; i++) {
+        nkit_mempool_free(pool, ptrs[i]);
+    }
+
+    // Every object is free again: the extra extents can be released
+    size_t released = nkit_mempool_trim(pool);
+    assert(released >= 2);
+
+    // ...and re-activated on the next burst
+    for (int i = 0; i < N; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, 256);
+        assert(ptrs[i] != NULL);
+    }
+    for (int i = 0; i < N; i++) {
+        nkit_mempool_free(pool, ptrs[i]);
+    }
+    nkit_mempool_trim(pool);
+    printf("  [+] Elastic growth and trim OK (%zu extents released).\n", released);
+}
+
+static void test_mempool_unbounded_class(nkit_mempool_t* pool) {
+    // 64 extents of the first extent's size used to be the end of a class
+    // on its node; now only node memory is
+    const size_t n = (size_t)NKIT_SLAB_MAX_EXTENTS * POOL_SLAB_CAPACITY * 2;
+    void** ptrs = malloc(n * sizeof(void*));
+    assert(ptrs != NULL);
+    for (size_t i = 0; i < n; i++) {
+        ptrs[i] = nkit_mempool_alloc(pool, 16);
+        assert(ptrs[i] != NULL);
+        *(size_t*)ptrs[i] = i;
+    }
+    for (size_t i = 0; i < n; i++) {
+        assert(*(size_t*)ptrs[i] == i);
+        nkit_mempool_free(pool, ptrs[i]);
+    }
+    free(ptrs);
+    nkit_mempool_trim(pool);
+    printf("  [+] Unbounded size class OK (%zu x 16B).\n", n);
+}
+
 int test_13_mempool(void) {
     printf("[UNIT] Advanced Memory Pool Test...\n");
 
@@ -44,11 +485,21 @@ int test_13_mempool(void) {
     nkit_mempool_free(pool, ptr4);
     printf("  [+] Deallocations successful (O(1) lock-free).\n");
 
-    // Test Over-allocation (should return NULL)
-    printf("  [+] Testing oversized allocation...\n");
-    void* ptr5 = nkit_mempool_alloc(pool, 32768); // Exceeds 16384 max class
-    assert(ptr5 == NULL);
-    printf("  [+] Oversized allocation correctly rejected.\n");
+    // Beyond the largest size class: served by the large-object tier
+    printf("  [+] Testing large allocations...\n");
+    test_mempool_large(pool);
+
+    test_mempool_header_free();
+    test_mempool_size_classes(pool);
+    test_mempool_aligned(pool);
+
+    // Thread cache behavior
+    test_mempool_magazine_reuse(pool);
+    test_mempool_thread_exit_flush(pool);
+    test_mempool_late_thread_free(pool);
+    test_mempool_remote_free(pool);
+    test_mempool_elastic_trim(pool);
+    test_mempool_unbounded_class(pool);
 
     // Test Destroy
     nkit_mempool_destroy(pool);
@@ -1,18 +1,16 @@
 #include <stdio.h>
 #include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
 
 #include <numakit/numakit.h>
 #include <numakit/structs/ring_buffer.h>
 #include "unit.h"
 
-int test_16_ring_buffer(void) {
-    printf("[UNIT] Ring Buffer Test Started...\n");
-
-    if (nkit_init() != 0) {
-        fprintf(stderr, "Failed to init libnumakit\n");
-        return 1;
-    }
-
+// ============================================================================
+// Test 1: Push / Pop
+// ============================================================================
+static void test_ring_push_pop(void) {
     // Must be power of 2
     size_t capacity = 1024;
     nkit_ring_t* ring = nkit_ring_create(0, capacity);
@@ -32,7 +30,7 @@ int test_16_ring_buffer(void) {
     for (size_t i = 3; i < capacity; i++) {
         assert(nkit_ring_push(ring, &fill_val));
     }
-    
+
     // Push one more, should fail (buffer full)
     assert(!nkit_ring_push(ring, &fill_val));
 
@@ -48,6 +46,156 @@ int test_16_ring_buffer(void) {
     assert(out == &val3);
 
     nkit_ring_free(ring);
+    printf("  [Check] Push / Pop: OK\n");
+}
+
+// ============================================================================
+// Test 2: Bulk And Burst Semantics
+// ============================================================================
+static void test_ring_bulk(void) {
+    nkit_ring_t* ring = nkit_ring_create(0, 16);
+    assert(ring != NULL);
+
+    void* in[32];
+    void* out[32];
+    for (uintptr_t i = 0; i < 32; i++) in[i] = (void*)(i + 1);
+
+    // Bulk is all-or-nothing
+    assert(nkit_ring_push_bulk(ring, in, 10) == 10);
+    assert(nkit_ring_push_bulk(ring, in + 10, 10) == 0);
+    assert(nkit_ring_pop_bulk(ring, out, 11) == 0);
+
+    // Burst takes what fits
+    assert(nkit_ring_push_burst(ring, in + 10, 10) == 6);
+    assert(nkit_ring_push_burst(ring, in, 1) == 0);
+    assert(!nkit_ring_push(ring, in[0]));
+
+    // Single and batched pops see the same FIFO order
+    void* one = NULL;
+    assert(nkit_ring_pop(ring, &one) && one == in[0]);
+    assert(nkit_ring_pop_bulk(ring, out, 9) == 9);
+    for (int i = 0; i < 9; i++) assert(out[i] == in[1 + i]);
+    assert(nkit_ring_pop_burst(ring, out, 32) == 6);
+    for (int i = 0; i < 6; i++) assert(out[i] == in[10 + i]);
+    assert(nkit_ring_pop_burst(ring, out, 32) == 0);
+    assert(!nkit_ring_pop(ring, &one));
+
+    // Batches wrap around the end of the cell array
+    for (int lap = 0; lap < 8; lap++) {
+        assert(nkit_ring_push(ring, in[lap]));
+        assert(nkit_ring_push_bulk(ring, in + 8, 12) == 12);
+        assert(nkit_ring_pop_bulk(ring, out, 13) == 13);
+        assert(out[0] == in[lap] && out[12] == in[19]);
+    }
+    assert(nkit_ring_push_bulk(ring, in, 0) == 0);
+    assert(nkit_ring_pop_burst(ring, out, 0) == 0);
+
+    nkit_ring_free(ring);
+    printf("  [Check] Bulk / Burst: OK\n");
+}
+
+// ============================================================================
+// Test 3: Concurrent Batches (MPMC)
+// ============================================================================
+#define BULK_THREADS   2
+#define BULK_PER_THREAD 200000
+#define BULK_BATCH      32
+
+typedef struct {
+    nkit_ring_t* ring;
+    int id;
+    uint64_t sum;
+    size_t count;
+} bulk_arg_t;
+
+static void* bulk_producer(void* p) {
+    bulk_arg_t* a = p;
+    void* batch[BULK_BATCH];
+    uintptr_t next = (uintptr_t)a->id * BULK_PER_THREAD + 1;
+    size_t sent = 0;
+
+    while (sent < BULK_PER_THREAD) {
+        // Alternate bulk, burst and single pushes
+        size_t n = BULK_PER_THREAD - sent < BULK_BATCH ? BULK_PER_THREAD - sent : BULK_BATCH;
+        for (size_t i = 0; i < n; i++) batch[i] = (void*)(next + i);
+
+        size_t done;
+        if (sent % 3 == 0) {
+            done = nkit_ring_push_bulk(a->ring, batch, n);
+        } else if (sent % 3 == 1) {
+            done = nkit_ring_push_burst(a->ring, batch, n);
+        } else {
+            done = nkit_ring_push(a->ring, batch[0]) ? 1 : 0;
+        }
+        if (done == 0) sched_yield();
+        next += done;
+        sent += done;
+    }
+    return NULL;
+}
+
+static void* bulk_consumer(void* p) {
+    bulk_arg_t* a = p;
+    void* batch[BULK_BATCH];
+
+    while (a->count < BULK_PER_THREAD) {
+        size_t want = BULK_PER_THREAD - a->count < BULK_BATCH ? BULK_PER_THREAD - a->count : BULK_BATCH;
+        size_t got = (a->count % 2) ? nkit_ring_pop_burst(a->ring, batch, want)
+                                    : (nkit_ring_pop(a->ring, &batch[0]) ? 1 : 0);
+        if (got == 0) sched_yield();
+        for (size_t i = 0; i < got; i++) a->sum += (uintptr_t)batch[i];
+        a->count += got;
+    }
+    return NULL;
+}
+
+static void test_ring_bulk_concurrent(void) {
+    nkit_ring_t* ring = nkit_ring_create(0, 256);
+    assert(ring != NULL);
+
+    pthread_t prod[BULK_THREADS], cons[BULK_THREADS];
+    bulk_arg_t pargs[BULK_THREADS], cargs[BULK_THREADS];
+
+    for (int i = 0; i < BULK_THREADS; i++) {
+        pargs[i] = (bulk_arg_t){ .ring = ring, .id = i };
+        cargs[i] = (bulk_arg_t){ .ring = ring, .id = i };
+        pthread_create(&cons[i], NULL, bulk_consumer, &cargs[i]);
+        pthread_create(&prod[i], NULL, bulk_producer, &pargs[i]);
+    }
+
+    uint64_t sum = 0;
+    for (int i = 0; i < BULK_THREADS; i++) {
+        pthread_join(prod[i], NULL);
+        pthread_join(cons[i], NULL);
+        sum += cargs[i].sum;
+    }
+
+    // Every value 1..N exactly once
+    uint64_t n = (uint64_t)BULK_THREADS * BULK_PER_THREAD;
+    assert(sum == n * (n + 1) / 2);
+
+    void* left;
+    assert(!nkit_ring_pop(ring, &left));
+
+    nkit_ring_free(ring);
+    printf("  [Check] Concurrent Bulk (%d x %d items): OK\n", BULK_THREADS, BULK_PER_THREAD);
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_16_ring_buffer(void) {
+    printf("[UNIT] Ring Buffer Test Started...\n");
+
+    if (nkit_init() != 0) {
+        fprintf(stderr, "Failed to init libnumakit\n");
+        return 1;
+    }
+
+    test_ring_push_pop();
+    test_ring_bulk();
+    test_ring_bulk_concurrent();
+
     nkit_teardown();
 
     printf("[UNIT] Ring Buffer Test Passed\n");
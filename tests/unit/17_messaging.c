@@ -40,6 +40,15 @@ int test_17_messaging(void) {
     assert(processed == 2);
     assert(processed_messages == 2);
 
+    // A burst larger than any fixed ring is absorbed, not rejected
+    static int burst_msg = 42;
+    for (int i = 0; i < 10000; i++) {
+        assert(nkit_send(current_node, &burst_msg) == 0);
+    }
+    processed = nkit_process_local(message_handler, 0);
+    printf("  [Check] Burst of 10000 messages: %zu processed\n", processed);
+    assert(processed == 10000);
+
     nkit_teardown();
     printf("[UNIT] Messaging Test Passed\n");
     return 0;
@@ -0,0 +1,710 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+#define MB (1024UL * 1024UL)
+
+// ============================================================================
+// Test 1: Fixed-Size Arena Still Reports Full
+// ============================================================================
+static void test_arena_fixed_full(void) {
+    nkit_arena_t *arena = nkit_arena_create(0, 2 * MB);
+    assert(arena != NULL);
+
+    assert(nkit_arena_alloc(arena, nkit_arena_size(arena)) != NULL);
+    assert(nkit_arena_alloc(arena, 64) == NULL);
+
+    // Trim is a no-op on fixed arenas
+    assert(nkit_arena_trim(arena) == 0);
+    assert(nkit_arena_size(arena) == 2 * MB);
+
+    nkit_arena_destroy(arena);
+    printf("  [Check] Fixed Arena Full: OK\n");
+}
+
+// ============================================================================
+// Test 2: Growable Arena Chains Chunks On Demand
+// ============================================================================
+static void test_arena_growable_chain(void) {
+    nkit_arena_t *arena = nkit_arena_create_growable(0, 2 * MB);
+    assert(arena != NULL);
+    assert(nkit_arena_size(arena) == 2 * MB);
+
+    // Fill the first chunk, then spill into a second one
+    void *a = nkit_arena_alloc(arena, 2 * MB);
+    void *b = nkit_arena_alloc(arena, 4096);
+    assert(a != NULL && b != NULL);
+    assert(nkit_arena_size(arena) == 4 * MB);
+    assert(nkit_arena_used(arena) == 2 * MB + 4096);
+
+    // Memory from both chunks must be writable
+    memset(a, 0x11, 2 * MB);
+    memset(b, 0x22, 4096);
+    assert(((unsigned char *)a)[2 * MB - 1] == 0x11);
+    assert(((unsigned char *)b)[0] == 0x22);
+
+    nkit_arena_destroy(arena);
+    printf("  [Check] Growable Chain: OK\n");
+}
+
+// ============================================================================
+// Test 3: Oversized Request Gets A Dedicated Chunk
+// ============================================================================
+static void test_arena_growable_oversized(void) {
+    nkit_arena_t *arena = nkit_arena_create_growable(0, 2 * MB);
+    assert(arena != NULL);
+
+    void *p = nkit_arena_alloc(arena, 5 * MB);
+    assert(p != NULL);
+    assert(((uintptr_t)p & 63) == 0);
+    memset(p, 0x33, 5 * MB);
+
+    // First chunk (2MB) + dedicated chunk rounded up to 6MB
+    assert(nkit_arena_size(arena) == 8 * MB);
+
+    nkit_arena_destroy(arena);
+    printf("  [Check] Oversized Chunk: OK\n");
+}
+
+// ============================================================================
+// Test 4: Reset Keeps Chunks, Trim Releases Them
+// ============================================================================
+static void test_arena_reset_trim(void) {
+    nkit_arena_t *arena = nkit_arena_create_growable(0, 2 * MB);
+    assert(arena != NULL);
+
+    for (int i = 0; i < 3; i++) {
+        assert(nkit_arena_alloc(arena, 2 * MB) != NULL);
+    }
+    assert(nkit_arena_size(arena) == 6 * MB);
+
+    // Reset: used drops to zero, chunks stay mapped
+    nkit_arena_reset(arena);
+    assert(nkit_arena_used(arena) == 0);
+    assert(nkit_arena_size(arena) == 6 * MB);
+
+    // Second cycle reuses retained chunks (no growth)
+    for (int i = 0; i < 3; i++) {
+        assert(nkit_arena_alloc(arena, 2 * MB) != NULL);
+    }
+    assert(nkit_arena_size(arena) == 6 * MB);
+
+    // Retained chunks beyond the current one are released by coalesce too
+    nkit_arena_reset(arena);
+    assert(nkit_arena_coalesce(arena) > 0);
+
+    // Trim back to the first chunk
+    size_t released = nkit_arena_trim(arena);
+    assert(released == 4 * MB);
+    assert(nkit_arena_size(arena) == 2 * MB);
+
+    // Still usable after trimming
+    void *p = nkit_arena_alloc(arena, 3 * MB);
+    assert(p != NULL);
+    memset(p, 0x44, 3 * MB);
+
+    nkit_arena_destroy(arena);
+    printf("  [Check] Reset/Trim: OK\n");
+}
+
+// ============================================================================
+// Test 5: Concurrent Arena Shared By Several Threads
+// ============================================================================
+#define CA_THREADS 4
+#define CA_ALLOCS  2000
+
+typedef struct {
+    nkit_arena_t  *arena;
+    int            id;
+    unsigned char *ptrs[CA_ALLOCS];
+    size_t         sizes[CA_ALLOCS];
+} ca_worker_t;
+
+static void *ca_worker(void *arg) {
+    ca_worker_t *w = (ca_worker_t *)arg;
+    for (int i = 0; i < CA_ALLOCS; i++) {
+        w->sizes[i] = 16 + (size_t)((i * 37 + w->id * 11) % 1000);
+        w->ptrs[i] = nkit_arena_alloc(w->arena, w->sizes[i]);
+        assert(w->ptrs[i] != NULL);
+        assert(((uintptr_t)w->ptrs[i] & 63) == 0);
+        memset(w->ptrs[i], w->id + 1, w->sizes[i]);
+    }
+    // One request above the sub-block threshold, reserved directly
+    unsigned char *big = nkit_arena_alloc(w->arena, 256 * 1024);
+    assert(big != NULL);
+    memset(big, w->id + 1, 256 * 1024);
+    return NULL;
+}
+
+static void test_arena_concurrent(void) {
+    nkit_arena_t *arena = nkit_arena_create_concurrent(0, 32 * MB);
+    assert(arena != NULL);
+
+    static ca_worker_t workers[CA_THREADS];
+    pthread_t threads[CA_THREADS];
+    for (int i = 0; i < CA_THREADS; i++) {
+        workers[i].arena = arena;
+        workers[i].id = i;
+        assert(pthread_create(&threads[i], NULL, ca_worker, &workers[i]) == 0);
+    }
+    for (int i = 0; i < CA_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // No two allocations overlap: every block still holds its owner's byte
+    for (int i = 0; i < CA_THREADS; i++) {
+        for (int j = 0; j < CA_ALLOCS; j++) {
+            assert(workers[i].ptrs[j][0] == i + 1);
+            assert(workers[i].ptrs[j][workers[i].sizes[j] - 1] == i + 1);
+        }
+    }
+    assert(nkit_arena_used(arena) <= nkit_arena_size(arena));
+
+    // Reset retires every thread's sub-block: allocation restarts at the base
+    void *first = nkit_arena_alloc(arena, 64);
+    nkit_arena_reset(arena);
+    assert(nkit_arena_used(arena) == 0);
+    void *again = nkit_arena_alloc(arena, 64);
+    assert(again != NULL && again != first);
+    assert(nkit_arena_used(arena) == 64 * 1024);
+
+    // Exhaustion: the tail is still handed out exactly, then NULL
+    nkit_arena_reset(arena);
+    size_t total = 0;
+    void *p;
+    while ((p = nkit_arena_alloc(arena, 4096)) != NULL) {
+        total += 4096;
+    }
+    assert(total == nkit_arena_size(arena));
+    assert(nkit_arena_alloc(arena, 64) == NULL);
+
+    nkit_arena_destroy(arena);
+    printf("  [Check] Concurrent Arena: OK\n");
+}
+
+// ============================================================================
+// Test 6: Explicit Page Size Selection And Backing Report
+// ============================================================================
+static void test_arena_page_sizes(void) {
+    // Standard pages on request
+    nkit_arena_attr_t attr = { .page_size = NKIT_PAGE_4K };
+    nkit_arena_t *arena = nkit_arena_create_ex(0, 4 * MB, &attr);
+    assert(arena != NULL);
+    assert(nkit_arena_backing(arena) == NKIT_PAGE_4K);
+    assert(nkit_arena_page_size(arena) == 4096);
+    assert(nkit_arena_is_huge(arena) == 0);
+    nkit_arena_destroy(arena);
+
+    // THP: 2MB-aligned mapping, either accepted (THP) or plain 4KB
+    attr.page_size = NKIT_PAGE_THP;
+    arena = nkit_arena_create_ex(0, 4 * MB, &attr);
+    assert(arena != NULL);
+    nkit_page_size_t thp = nkit_arena_backing(arena);
+    assert(thp == NKIT_PAGE_THP || thp == NKIT_PAGE_4K);
+    void *p = nkit_arena_alloc(arena, 64);
+    assert(((uintptr_t)p & (2 * MB - 1)) == 0);
+    memset(p, 0x5A, 64);
+    nkit_arena_destroy(arena);
+
+    // 2MB / 1GB: whatever we get must be a real backing and usable
+    nkit_page_size_t wants[] = { NKIT_PAGE_2M, NKIT_PAGE_1G, NKIT_PAGE_DEFAULT };
+    for (int i = 0; i < 3; i++) {
+        attr.page_size = wants[i];
+        attr.strict = 0;
+        arena = nkit_arena_create_ex(0, 2 * MB, &attr);
+        assert(arena != NULL);
+        nkit_page_size_t got = nkit_arena_backing(arena);
+        assert(got >= NKIT_PAGE_4K && got <= NKIT_PAGE_1G);
+        if (wants[i] != NKIT_PAGE_DEFAULT) assert(got <= wants[i]);
+        assert(nkit_arena_size(arena) % nkit_arena_page_size(arena) == 0);
+        assert(nkit_arena_is_huge(arena) == (got >= NKIT_PAGE_2M));
+        p = nkit_arena_alloc(arena, 1024);
+        assert(p != NULL);
+        memset(p, 0x6B, 1024);
+        nkit_arena_destroy(arena);
+
+        // Strict requests either get exactly that backing or fail
+        attr.strict = 1;
+        arena = nkit_arena_create_ex(0, 2 * MB, &attr);
+        if (arena && wants[i] != NKIT_PAGE_DEFAULT) {
+            assert(nkit_arena_backing(arena) == wants[i]);
+        }
+        nkit_arena_destroy(arena);
+    }
+
+    attr.page_size = (nkit_page_size_t)42;
+    assert(nkit_arena_create_ex(0, 2 * MB, &attr) == NULL);
+
+    printf("  [Check] Page Size Selection: OK\n");
+}
+
+// ============================================================================
+// Test 7: Pre-faulting (Populate And Parallel First-Touch)
+// ============================================================================
+static size_t resident_pages(void *base, size_t size) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t n = size / page, resident = 0;
+    unsigned char *vec = malloc(n);
+    assert(vec != NULL);
+    assert(mincore(base, size, vec) == 0);
+    for (size_t i = 0; i < n; i++) {
+        resident += vec[i] & 1;
+    }
+    free(vec);
+    return resident;
+}
+
+static void test_arena_prefault(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    nkit_arena_attr_t attr = { .page_size = NKIT_PAGE_4K };
+
+    // Lazy by default: nothing resident, no time spent
+    nkit_arena_t *lazy = nkit_arena_create_ex(0, 16 * MB, &attr);
+    assert(lazy != NULL);
+    void *base = nkit_arena_alloc(lazy, 64);
+    assert(nkit_arena_prefault_ns(lazy) == 0);
+    assert(resident_pages(base, 16 * MB) < (16 * MB) / page);
+    nkit_arena_destroy(lazy);
+
+    nkit_prefault_t modes[] = { NKIT_PREFAULT_POPULATE, NKIT_PREFAULT_PARALLEL };
+    for (int m = 0; m < 2; m++) {
+        attr.prefault = modes[m];
+        attr.prefault_threads = 3; // Uneven split on purpose
+        nkit_arena_t *arena = nkit_arena_create_ex(0, 16 * MB, &attr);
+        assert(arena != NULL);
+        assert(nkit_arena_prefault_ns(arena) > 0);
+
+        // Every page is already faulted in, and still zero
+        unsigned char *p = nkit_arena_alloc(arena, 16 * MB);
+        assert(p != NULL);
+        assert(resident_pages(p, 16 * MB) == (16 * MB) / page);
+        assert(p[0] == 0 && p[16 * MB - 1] == 0);
+        nkit_arena_destroy(arena);
+    }
+
+    // Default worker count: one per CPU of the node
+    attr.prefault = NKIT_PREFAULT_PARALLEL;
+    attr.prefault_threads = 0;
+    nkit_arena_t *arena = nkit_arena_create_ex(0, 2 * MB, &attr);
+    assert(arena != NULL);
+    assert(nkit_arena_prefault_ns(arena) > 0);
+    nkit_arena_destroy(arena);
+
+    // Growable arenas pre-fault every chunk they map, not just the first
+    attr.prefault = NKIT_PREFAULT_POPULATE;
+    arena = nkit_arena_create_growable_ex(0, 2 * MB, &attr);
+    assert(arena != NULL);
+    assert(nkit_arena_alloc(arena, 2 * MB) != NULL);
+    uint64_t first_ns = nkit_arena_prefault_ns(arena);
+    unsigned char *grown = nkit_arena_alloc(arena, 4 * MB);
+    assert(grown != NULL);
+    assert(nkit_arena_prefault_ns(arena) > first_ns);
+    assert(resident_pages(grown, 4 * MB) == (4 * MB) / page);
+    nkit_arena_destroy(arena);
+
+    attr.prefault = (nkit_prefault_t)7;
+    assert(nkit_arena_create_ex(0, 2 * MB, &attr) == NULL);
+
+    printf("  [Check] Prefault Modes: OK\n");
+}
+
+// ============================================================================
+// Test 8: Placement Policies, Verified Page By Page
+// ============================================================================
+static void test_arena_policies(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t npages = (8 * MB) / page;
+    int *nodes = malloc(npages * sizeof(int));
+    assert(nodes != NULL);
+
+    nkit_mem_policy_t policies[] = {
+        NKIT_POLICY_INTERLEAVE, NKIT_POLICY_WEIGHTED_INTERLEAVE, NKIT_POLICY_PREFERRED_MANY
+    };
+    for (int p = 0; p < 3; p++) {
+        nkit_arena_attr_t attr = {
+            .page_size = NKIT_PAGE_4K, .policy = policies[p], .nodemask = 1
+        };
+        attr.weights[0] = 3;
+
+        nkit_arena_t *arena = nkit_arena_create_ex(0, 8 * MB, &attr);
+        assert(arena != NULL);
+        char *base = nkit_arena_alloc(arena, 8 * MB);
+        assert(base != NULL);
+
+        // Touch the first half only
+        memset(base, 1, 4 * MB);
+        assert(nkit_memory_page_nodes(base, 8 * MB, nodes) == (long)npages);
+        for (size_t i = 0; i < npages / 2; i++) assert(nodes[i] == 0);
+        assert(nodes[npages - 1] < 0);
+
+        nkit_arena_destroy(arena);
+    }
+
+    // With two or more nodes, weights 1:3 put 3 of every 4 stripes on node 1
+    if (nkit_topo_num_nodes() >= 2) {
+        nkit_arena_attr_t attr = {
+            .page_size = NKIT_PAGE_4K, .policy = NKIT_POLICY_WEIGHTED_INTERLEAVE,
+            .nodemask = 3
+        };
+        attr.weights[0] = 1;
+        attr.weights[1] = 3;
+
+        nkit_arena_t *arena = nkit_arena_create_ex(0, 8 * MB, &attr);
+        assert(arena != NULL);
+        char *base = nkit_arena_alloc(arena, 8 * MB);
+        memset(base, 1, 8 * MB);
+        assert(nkit_memory_page_nodes(base, 8 * MB, nodes) == (long)npages);
+
+        size_t per_stripe = (2 * MB) / page;
+        for (size_t i = 0; i < npages; i++) {
+            assert(nodes[i] == ((i / per_stripe) % 4 == 0 ? 0 : 1));
+        }
+        nkit_arena_destroy(arena);
+    } else {
+        printf("  [~] Multi-node weighted interleave skipped (single node).\n");
+    }
+
+    nkit_arena_attr_t bad = { .policy = (nkit_mem_policy_t)9 };
+    assert(nkit_arena_create_ex(0, 2 * MB, &bad) == NULL);
+
+    free(nodes);
+    printf("  [Check] Placement Policies: OK\n");
+}
+
+// ============================================================================
+// Test 9: Nested Marks And Rewind
+// ============================================================================
+static void test_arena_mark_rewind(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    nkit_arena_attr_t attr = { .page_size = NKIT_PAGE_4K };
+    nkit_arena_t *arena = nkit_arena_create_ex(0, 32 * MB, &attr);
+    assert(arena != NULL);
+
+    char *live = nkit_arena_alloc(arena, 1000);
+    nkit_arena_mark_t outer = nkit_arena_mark(arena);
+    size_t outer_used = nkit_arena_used(arena);
+
+    char *a = nkit_arena_alloc(arena, 4096);
+    nkit_arena_mark_t inner = nkit_arena_mark(arena);
+
+    // Deep scratch burst inside the inner scope
+    char *burst = nkit_arena_alloc(arena, 16 * MB);
+    assert(burst != NULL);
+    memset(burst, 1, 16 * MB);
+    char *base = live;
+    assert(resident_pages(base, 24 * MB) >= (16 * MB) / page);
+
+    // Rewinding keeps the first 2MB above the mark warm, releases the rest
+    assert(nkit_arena_rewind(arena, inner) == 0);
+    assert(nkit_arena_alloc(arena, 64) == burst);
+    assert(resident_pages(base, 24 * MB) <= (3 * MB) / page);
+
+    // Small bursts within the slack are not released
+    memset(burst, 2, MB);
+    assert(nkit_arena_rewind(arena, inner) == 0);
+    assert(resident_pages(base, 4 * MB) >= MB / page);
+
+    // Outer rewind frees the inner scope too; older data survives
+    memset(live, 7, 1000);
+    assert(nkit_arena_rewind(arena, outer) == 0);
+    assert(nkit_arena_used(arena) == outer_used);
+    assert(nkit_arena_alloc(arena, 4096) == a);
+    assert(live[999] == 7);
+
+    // A mark left above the position by a later rewind is rejected
+    nkit_arena_mark_t deep = nkit_arena_mark(arena);
+    assert(nkit_arena_rewind(arena, outer) == 0);
+    assert(nkit_arena_rewind(arena, deep) == -1);
+
+    // A burst dropped by reset is still released by the next rewind
+    burst = nkit_arena_alloc(arena, 16 * MB);
+    memset(burst, 3, 16 * MB);
+    nkit_arena_reset(arena);
+    nkit_arena_alloc(arena, 1000);
+    nkit_arena_mark_t after_reset = nkit_arena_mark(arena);
+    assert(nkit_arena_rewind(arena, after_reset) == 0);
+    assert(resident_pages(base, 24 * MB) <= (3 * MB) / page);
+    nkit_arena_destroy(arena);
+
+    // Growable: rewinding across chunks keeps them for the next burst
+    arena = nkit_arena_create_growable(0, 2 * MB);
+    assert(arena != NULL);
+    nkit_arena_alloc(arena, 128);
+    nkit_arena_mark_t m = nkit_arena_mark(arena);
+    for (int i = 0; i < 4; i++) assert(nkit_arena_alloc(arena, MB + 4096) != NULL);
+    size_t grown = nkit_arena_size(arena);
+    assert(grown > 2 * MB);
+
+    assert(nkit_arena_rewind(arena, m) == 0);
+    assert(nkit_arena_used(arena) == 128);
+    for (int i = 0; i < 4; i++) assert(nkit_arena_alloc(arena, MB + 4096) != NULL);
+    assert(nkit_arena_size(arena) == grown);
+    nkit_arena_destroy(arena);
+
+    // Chunks dirtied before a reset, past a shallower refill, are released too
+    arena = nkit_arena_create_growable_ex(0, 2 * MB, &attr);
+    assert(arena != NULL);
+    char *chunks[4];
+    for (int i = 0; i < 4; i++) {
+        chunks[i] = nkit_arena_alloc(arena, MB + 4096);
+        assert(chunks[i] != NULL);
+        memset(chunks[i], 4, MB + 4096);
+    }
+    nkit_arena_reset(arena);
+    m = nkit_arena_mark(arena);
+    for (int i = 0; i < 2; i++) assert(nkit_arena_alloc(arena, MB + 4096) == chunks[i]);
+    assert(nkit_arena_rewind(arena, m) == 0);
+    assert(resident_pages(chunks[2], MB + 4096) == 0);
+    assert(resident_pages(chunks[3], MB + 4096) == 0);
+    nkit_arena_destroy(arena);
+
+    // Concurrent arenas have no single position to mark
+    arena = nkit_arena_create_concurrent(0, 2 * MB);
+    m = nkit_arena_mark(arena);
+    assert(nkit_arena_rewind(arena, m) == -1);
+    nkit_arena_destroy(arena);
+
+    printf("  [Check] Mark/Rewind: OK\n");
+}
+
+// ============================================================================
+// Test 10: Aligned, Packed And Typed Allocation
+// ============================================================================
+typedef struct { double x, y, z; } vec3_t;
+
+static void test_arena_aligned(void) {
+    nkit_arena_t *arena = nkit_arena_create_growable(0, 2 * MB);
+    assert(arena != NULL);
+
+    // Packed: consecutive objects are adjacent, no rounding
+    char *p1 = nkit_arena_alloc_packed(arena, 3);
+    char *p2 = nkit_arena_alloc_packed(arena, 5);
+    assert(p2 == p1 + 3);
+    assert(nkit_arena_used(arena) == 8);
+
+    // Typed arrays get natural alignment and stay dense
+    vec3_t *v = NKIT_ARENA_NEW_ARRAY(arena, vec3_t, 10);
+    assert(((uintptr_t)v % _Alignof(vec3_t)) == 0);
+    assert((char *)v == p1 + 8);
+    uint16_t *h = NKIT_ARENA_NEW(arena, uint16_t);
+    assert((char *)h == (char *)(v + 10));
+
+    // The default allocator still starts on a cache line after packed data
+    char *line = nkit_arena_alloc(arena, 1);
+    assert(((uintptr_t)line & 63) == 0);
+
+    // Arbitrary power-of-two alignments, including on a freshly mapped chunk
+    size_t aligns[] = { 128, 4096, 2 * MB };
+    for (int i = 0; i < 3; i++) {
+        char *a = nkit_arena_alloc_aligned(arena, 100, aligns[i]);
+        assert(a != NULL && ((uintptr_t)a & (aligns[i] - 1)) == 0);
+    }
+    char *big = nkit_arena_alloc_aligned(arena, 3 * MB, 4096);
+    assert(big != NULL && ((uintptr_t)big & 4095) == 0);
+    memset(big, 0, 3 * MB);
+
+    assert(nkit_arena_alloc_aligned(arena, 8, 48) == NULL);
+    assert(nkit_arena_alloc_aligned(arena, 8, 0) == NULL);
+    assert(nkit_arena_alloc_array(arena, SIZE_MAX / 2, 4, 4) == NULL);
+    nkit_arena_destroy(arena);
+
+    // Concurrent arenas honour alignment inside per-thread sub-blocks
+    arena = nkit_arena_create_concurrent(0, 8 * MB);
+    char *c1 = nkit_arena_alloc_packed(arena, 7);
+    char *c2 = nkit_arena_alloc_packed(arena, 9);
+    assert(c2 == c1 + 7);
+    char *c3 = nkit_arena_alloc_aligned(arena, 64, 4096);
+    assert(((uintptr_t)c3 & 4095) == 0);
+    char *c4 = nkit_arena_alloc_aligned(arena, 256 * 1024, 8192);
+    assert(c4 != NULL && ((uintptr_t)c4 & 8191) == 0);
+    nkit_arena_destroy(arena);
+
+    // Sizes that would wrap once alignment slack is added are refused,
+    // whatever kind of arena serves them
+    nkit_arena_t *kinds[] = { nkit_arena_create(0, 2 * MB),
+                              nkit_arena_create_growable(0, 2 * MB),
+                              nkit_arena_create_concurrent(0, 2 * MB) };
+    for (int i = 0; i < 3; i++) {
+        assert(kinds[i] != NULL);
+        assert(nkit_arena_alloc_aligned(kinds[i], SIZE_MAX - 100, 4096) == NULL);
+        assert(nkit_arena_alloc_aligned(kinds[i], SIZE_MAX - 2 * MB, 64) == NULL);
+        assert(nkit_arena_alloc_packed(kinds[i], SIZE_MAX) == NULL);
+        assert(nkit_arena_alloc_packed(kinds[i], SIZE_MAX - 10) == NULL);
+        assert(nkit_arena_alloc(kinds[i], SIZE_MAX - 10) == NULL);
+
+        // ...and leave the arena usable
+        char *after = nkit_arena_alloc_packed(kinds[i], 16);
+        assert(after != NULL);
+        memset(after, 0, 16);
+        nkit_arena_destroy(kinds[i]);
+    }
+
+    printf("  [Check] Aligned/Packed/Typed Alloc: OK\n");
+}
+
+// ============================================================================
+// Test 11: File-Backed Arenas
+// ============================================================================
+static void write_pattern(const char *path, size_t len) {
+    FILE *f = fopen(path, "wb");
+    assert(f != NULL);
+    for (size_t i = 0; i < len; i++) fputc((int)(i % 251), f);
+    fclose(f);
+}
+
+static void test_arena_file(void) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    char path[] = "/tmp/nkit_arena_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+
+    // An odd-sized file: contents first, allocations right after
+    size_t len = 3 * MB + 123;
+    write_pattern(path, len);
+
+    nkit_arena_file_attr_t attr = { .arena.prefault = NKIT_PREFAULT_PARALLEL };
+    nkit_arena_t *arena = nkit_arena_create_file(0, path, 8 * MB, &attr);
+    assert(arena != NULL);
+    assert(nkit_arena_size(arena) == 8 * MB);
+    assert(nkit_arena_used(arena) == len);
+    assert(nkit_arena_prefault_ns(arena) > 0);
+    assert(resident_pages(nkit_arena_file_data(arena, NULL), 3 * MB) == (3 * MB) / page);
+
+    size_t bytes = 0;
+    unsigned char *data = nkit_arena_file_data(arena, &bytes);
+    assert(data != NULL && bytes == len);
+    for (size_t i = 0; i < len; i += 4093) assert(data[i] == i % 251);
+    assert(data[len - 1] == (len - 1) % 251);
+
+    unsigned char *p = nkit_arena_alloc(arena, 64);
+    assert(p >= data + len && p < data + len + 64);
+    memset(p, 0xee, 64);
+
+    // Private mapping: writes stay out of the file; reset keeps the contents
+    data[0] = 0xff;
+    nkit_arena_reset(arena);
+    assert(nkit_arena_used(arena) == len);
+    assert(nkit_arena_alloc(arena, 64) == p);
+    assert(nkit_arena_sync(arena) == 0);
+    nkit_arena_destroy(arena);
+
+    arena = nkit_arena_create_file(0, path, 0, NULL);
+    assert(arena != NULL);
+    data = nkit_arena_file_data(arena, NULL);
+    assert(data[0] == 0);
+    nkit_arena_destroy(arena);
+
+    // Read-only contents: allocations start on the next page
+    attr = (nkit_arena_file_attr_t){ .readonly = 1 };
+    arena = nkit_arena_create_file(0, path, 8 * MB, &attr);
+    assert(arena != NULL);
+    data = nkit_arena_file_data(arena, NULL);
+    p = nkit_arena_alloc(arena, 64);
+    assert(p == data + ((len + page - 1) & ~(page - 1)));
+    memset(p, 1, 64);
+    nkit_arena_destroy(arena);
+
+    // Shared: allocations land in the file, which grows to the arena size
+    unlink(path);
+    attr = (nkit_arena_file_attr_t){ .shared = 1 };
+    arena = nkit_arena_create_file(0, path, 4 * MB, &attr);
+    assert(arena != NULL);
+    assert(nkit_arena_used(arena) == 0);
+    char *msg = nkit_arena_alloc(arena, 32);
+    strcpy(msg, "persisted by numakit");
+    assert(nkit_arena_sync(arena) == 0);
+    nkit_arena_destroy(arena);
+
+    arena = nkit_arena_create_file(0, path, 0, NULL);
+    assert(arena != NULL);
+    data = nkit_arena_file_data(arena, &bytes);
+    assert(bytes == 4 * MB);
+    assert(strcmp((char *)data, "persisted by numakit") == 0);
+    assert(nkit_arena_alloc(arena, 64) == NULL); // Exactly the file: full
+    nkit_arena_destroy(arena);
+
+    // Shared files keep their length unless a larger size is asked for,
+    // and then get exactly that size (no rounding to pages)
+    write_pattern(path, 12);
+    struct stat st;
+    arena = nkit_arena_create_file(0, path, 0, &attr);
+    assert(arena != NULL);
+    assert(stat(path, &st) == 0 && st.st_size == 12);
+    nkit_arena_destroy(arena);
+    assert(stat(path, &st) == 0 && st.st_size == 12);
+
+    arena = nkit_arena_create_file(0, path, 10000, &attr);
+    assert(arena != NULL);
+    assert(stat(path, &st) == 0 && st.st_size == 10000);
+    nkit_arena_destroy(arena);
+
+    arena = nkit_arena_create_file(0, path, 0, &attr);
+    assert(arena != NULL);
+    nkit_arena_destroy(arena);
+    arena = nkit_arena_create_file(0, path, 5000, &attr);
+    assert(arena != NULL);
+    nkit_arena_destroy(arena);
+    assert(stat(path, &st) == 0 && st.st_size == 10000);
+
+    unlink(path);
+    assert(nkit_arena_create_file(0, path, 0, NULL) == NULL); // Missing
+    assert(nkit_arena_create_file(0, "/tmp", 0, NULL) == NULL); // Not a file
+    assert(nkit_arena_file_data(NULL, NULL) == NULL);
+
+    printf("  [Check] File-Backed Arenas: OK\n");
+}
+
+// ============================================================================
+// Test 12: NULL Safety
+// ============================================================================
+static void test_arena_null_safety(void) {
+    assert(nkit_arena_alloc(NULL, 64) == NULL);
+    assert(nkit_arena_trim(NULL) == 0);
+    assert(nkit_arena_create_growable(0, 0) == NULL);
+    assert(nkit_arena_create_concurrent(0, 0) == NULL);
+    assert(nkit_arena_backing(NULL) == NKIT_PAGE_DEFAULT);
+    assert(nkit_arena_page_size(NULL) == 0);
+    assert(nkit_arena_prefault_ns(NULL) == 0);
+    assert(nkit_memory_page_nodes(NULL, 4096, NULL) == -1);
+    nkit_arena_mark_t none = nkit_arena_mark(NULL);
+    assert(nkit_arena_rewind(NULL, none) == -1);
+    assert(nkit_arena_alloc_aligned(NULL, 64, 64) == NULL);
+    assert(nkit_arena_alloc_packed(NULL, 64) == NULL);
+    nkit_arena_reset(NULL);
+    nkit_arena_destroy(NULL);
+
+    printf("  [Check] NULL Safety: OK\n");
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_19_arena(void) {
+    printf("[UNIT] Arena Test Started...\n");
+
+    test_arena_fixed_full();
+    test_arena_growable_chain();
+    test_arena_growable_oversized();
+    test_arena_reset_trim();
+    test_arena_concurrent();
+    test_arena_page_sizes();
+    test_arena_prefault();
+    test_arena_policies();
+    test_arena_mark_rewind();
+    test_arena_aligned();
+    test_arena_file();
+    test_arena_null_safety();
+
+    printf("[UNIT] Arena Test Passed\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+#define MB (1024UL * 1024UL)
+
+// ============================================================================
+// Test 1: Arena Mappings Are Accounted Per Node And Backing
+// ============================================================================
+static void test_stats_arena_mapped(void) {
+    nkit_mem_stats_t before, during, after;
+    assert(nkit_mem_stats_snapshot(&before) == 0);
+    assert(before.num_nodes >= 1);
+
+    nkit_arena_attr_t attr = { .page_size = NKIT_PAGE_4K, .strict = 1 };
+    nkit_arena_t *arena = nkit_arena_create_ex(0, 8 * MB, &attr);
+    assert(arena != NULL);
+
+    assert(nkit_mem_stats_snapshot(&during) == 0);
+    assert(during.nodes[0].bytes_4k - before.nodes[0].bytes_4k == 8 * MB);
+    assert(during.nodes[0].bytes_mapped - before.nodes[0].bytes_mapped == 8 * MB);
+    assert(during.total.bytes_mapped - before.total.bytes_mapped == 8 * MB);
+
+    nkit_arena_destroy(arena);
+    assert(nkit_mem_stats_snapshot(&after) == 0);
+    assert(after.nodes[0].bytes_mapped == before.nodes[0].bytes_mapped);
+
+    // THP-advised chunks count as hugepage-backed
+    attr.page_size = NKIT_PAGE_THP;
+    arena = nkit_arena_create_ex(0, 4 * MB, &attr);
+    if (arena) {
+        assert(nkit_mem_stats_snapshot(&during) == 0);
+        assert(during.nodes[0].bytes_huge - before.nodes[0].bytes_huge == 4 * MB);
+        nkit_arena_destroy(arena);
+    }
+
+    printf("  [Check] Arena Mapped Bytes: OK\n");
+}
+
+// ============================================================================
+// Test 2: Slab Objects In Use And Exhaustion Events
+// ============================================================================
+static void test_stats_slab(void) {
+    nkit_mem_stats_t before, during;
+    assert(nkit_mem_stats_snapshot(&before) == 0);
+
+    nkit_slab_t *slab = nkit_slab_create(0, 64, 16);
+    assert(slab != NULL);
+
+    void *objs[16];
+    for (int i = 0; i < 16; i++) {
+        objs[i] = nkit_slab_alloc(slab);
+        assert(objs[i] != NULL);
+    }
+    assert(nkit_slab_alloc(slab) == NULL); // Fixed slab: exhausted
+
+    assert(nkit_mem_stats_snapshot(&during) == 0);
+    assert(during.nodes[0].bytes_in_use - before.nodes[0].bytes_in_use == 16 * 64);
+    assert(during.nodes[0].slab_exhausted - before.nodes[0].slab_exhausted == 1);
+
+    for (int i = 0; i < 16; i++) nkit_slab_free(slab, objs[i]);
+    assert(nkit_mem_stats_snapshot(&during) == 0);
+    assert(during.nodes[0].bytes_in_use == before.nodes[0].bytes_in_use);
+
+    nkit_slab_destroy(slab);
+    printf("  [Check] Slab In-Use / Exhaustion: OK\n");
+}
+
+// ============================================================================
+// Test 3: Mempool Large Blocks
+// ============================================================================
+static void test_stats_mempool(void) {
+    nkit_mempool_t *pool = nkit_mempool_create();
+    assert(pool != NULL);
+
+    nkit_mem_stats_t before, during, after;
+    assert(nkit_mem_stats_snapshot(&before) == 0);
+
+    int node = nkit_get_current_node();
+    if (node < 0 || node >= before.num_nodes) node = 0;
+
+    void *big = nkit_mempool_alloc(pool, 100 * 1024);
+    assert(big != NULL);
+    assert(nkit_mem_stats_snapshot(&during) == 0);
+    // The whole span counts, including its small descriptor prefix
+    uint64_t grew = during.total.bytes_in_use - before.total.bytes_in_use;
+    assert(grew >= nkit_mempool_class_size(pool, 100 * 1024));
+    assert(grew < nkit_mempool_class_size(pool, 100 * 1024) + 4096);
+    assert(during.total.remote_fallbacks == before.total.remote_fallbacks);
+
+    nkit_mempool_free(pool, big);
+    assert(nkit_mem_stats_snapshot(&after) == 0);
+    assert(after.total.bytes_in_use == before.total.bytes_in_use);
+
+    // Destroying a pool with live large blocks drops them from the counters
+    big = nkit_mempool_alloc(pool, 100 * 1024);
+    nkit_mempool_destroy(pool);
+    assert(nkit_mem_stats_snapshot(&after) == 0);
+    assert(after.total.bytes_in_use <= before.total.bytes_in_use);
+    assert(after.nodes[node].bytes_mapped <= before.nodes[node].bytes_mapped);
+
+    assert(nkit_mem_stats_snapshot(NULL) == -1);
+    printf("  [Check] Mempool Large Blocks: OK\n");
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_21_mem_stats(void) {
+    printf("[UNIT] Memory Telemetry Test Started...\n");
+
+    if (nkit_init() != 0) {
+        printf("Failed to initialize libnumakit\n");
+        return 1;
+    }
+
+    test_stats_arena_mapped();
+    test_stats_slab();
+    test_stats_mempool();
+
+    printf("[UNIT] Memory Telemetry Test Passed\n");
+    return 0;
+}
@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+#define MB (1024UL * 1024UL)
+
+typedef struct {
+    int calls;
+    int node;
+    nkit_pressure_level_t level;
+} pressure_log_t;
+
+static void on_change(int node, nkit_pressure_level_t level, void *arg) {
+    pressure_log_t *log = arg;
+    log->calls++;
+    log->node = node;
+    log->level = level;
+}
+
+// ============================================================================
+// Test 1: Thresholds, Callbacks And Hysteresis
+// ============================================================================
+static void test_pressure_levels(void) {
+    assert(nkit_pressure_level(0) == NKIT_PRESSURE_NONE);
+
+    // No node is 100% free: every node is LOW. The worker stays asleep,
+    // samples are taken with nkit_pressure_poll().
+    nkit_pressure_attr_t attr = { .low_free_pct = 100.0, .critical_free_pct = -1,
+                                  .interval_ms = 60000 };
+    nkit_pressure_t *mon = nkit_pressure_create(&attr);
+    assert(mon != NULL);
+    assert(nkit_pressure_create(NULL) == NULL); // One monitor at a time
+
+    pressure_log_t log = { 0 };
+    assert(nkit_pressure_on_change(mon, on_change, &log) == 0);
+
+    int nodes = nkit_topo_num_nodes();
+    assert(nkit_pressure_poll(mon) == nodes);
+    assert(log.calls == nodes);
+    assert(log.level == NKIT_PRESSURE_LOW);
+    assert(nkit_pressure_level(0) == NKIT_PRESSURE_LOW);
+
+    // Unchanged levels are not reported again
+    assert(nkit_pressure_poll(mon) == 0);
+    assert(log.calls == nodes);
+
+    nkit_pressure_destroy(mon);
+    assert(nkit_pressure_level(0) == NKIT_PRESSURE_NONE);
+
+    // Default thresholds: a healthy test machine is not under pressure
+    mon = nkit_pressure_create(NULL);
+    assert(mon != NULL);
+    nkit_pressure_poll(mon);
+    nkit_pressure_destroy(mon);
+
+    printf("  [Check] Levels / Callbacks: OK\n");
+}
+
+// ============================================================================
+// Test 2: Watched Allocators Are Reclaimed
+// ============================================================================
+static void test_pressure_reclaim(void) {
+    nkit_pressure_attr_t attr = { .low_free_pct = 100.0, .critical_free_pct = -1,
+                                  .interval_ms = 60000 };
+    nkit_pressure_t *mon = nkit_pressure_create(&attr);
+    assert(mon != NULL);
+
+    // An idle growable arena keeping chunks from an earlier burst
+    nkit_arena_t *arena = nkit_arena_create_growable(0, 2 * MB);
+    assert(arena != NULL);
+    for (int i = 0; i < 4; i++) {
+        assert(nkit_arena_alloc(arena, 2 * MB) != NULL);
+    }
+    nkit_arena_reset(arena);
+    assert(nkit_arena_size(arena) > 2 * MB);
+
+    // An elastic slab that grew and is now entirely free
+    nkit_slab_t *slab = nkit_slab_create_elastic(0, 64, 64, 8);
+    assert(slab != NULL);
+    void *objs[256];
+    for (int i = 0; i < 256; i++) {
+        objs[i] = nkit_slab_alloc(slab);
+        assert(objs[i] != NULL);
+    }
+    for (int i = 0; i < 256; i++) nkit_slab_free(slab, objs[i]);
+    assert(nkit_slab_capacity(slab) == 256);
+
+    nkit_mempool_t *pool = nkit_mempool_create();
+    assert(pool != NULL);
+
+    assert(nkit_pressure_watch_arena(mon, arena) == 0);
+    assert(nkit_pressure_watch_slab(mon, slab) == 0);
+    assert(nkit_pressure_watch_mempool(mon, pool) == 0);
+
+    assert(nkit_pressure_poll(mon) > 0);
+    assert(nkit_arena_size(arena) == 2 * MB);
+    assert(nkit_slab_capacity(slab) == 64);
+
+    // Once unwatched, objects are left alone (and may be destroyed)
+    assert(nkit_pressure_unwatch(mon, arena) == 0);
+    assert(nkit_pressure_unwatch(mon, arena) == -1);
+    assert(nkit_pressure_unwatch(mon, slab) == 0);
+    assert(nkit_pressure_unwatch(mon, pool) == 0);
+
+    nkit_pressure_destroy(mon);
+    nkit_mempool_destroy(pool);
+    nkit_slab_destroy(slab);
+    nkit_arena_destroy(arena);
+
+    printf("  [Check] Arena / Slab / Mempool Reclaim: OK\n");
+}
+
+// ============================================================================
+// Test 3: Spilling Arenas
+// ============================================================================
+static void test_pressure_spill(void) {
+    nkit_pressure_attr_t attr = { .low_free_pct = 100.0, .critical_free_pct = -1,
+                                  .interval_ms = 60000 };
+    nkit_pressure_t *mon = nkit_pressure_create(&attr);
+    assert(mon != NULL);
+    assert(nkit_pressure_poll(mon) > 0);
+
+    // Every node is LOW: there is nowhere better to go, node 0 is kept
+    nkit_arena_attr_t aattr = { .spill = 1 };
+    nkit_arena_t *arena = nkit_arena_create_ex(0, 2 * MB, &aattr);
+    assert(arena != NULL);
+    char *p = nkit_arena_alloc(arena, 4096);
+    assert(p != NULL);
+    memset(p, 1, 4096);
+
+    int where = -1;
+    assert(nkit_memory_page_nodes(p, 1, &where) == 1);
+    if (nkit_topo_is_numa()) assert(where == 0);
+    nkit_arena_destroy(arena);
+
+    // Growable arenas take the attribute too, and still grow
+    arena = nkit_arena_create_growable_ex(0, 2 * MB, &aattr);
+    assert(arena != NULL);
+    assert(nkit_arena_alloc(arena, 2 * MB) != NULL);
+    p = nkit_arena_alloc(arena, 4096);
+    assert(p != NULL);
+    memset(p, 1, 4096);
+    assert(nkit_arena_size(arena) > 2 * MB);
+    assert(nkit_memory_page_nodes(p, 1, &where) == 1);
+    if (nkit_topo_is_numa()) assert(where == 0);
+    nkit_arena_destroy(arena);
+    nkit_pressure_destroy(mon);
+
+    if (nkit_topo_num_nodes() < 2) {
+        printf("  [~] Spill to another node skipped (single node).\n");
+        printf("  [Check] Spill Stays Put Without Headroom: OK\n");
+        return;
+    }
+
+    // Only node 0 under pressure: a spilling arena lands elsewhere, and a
+    // growable one created before the pressure moves its next chunk
+    nkit_arena_t *grown = nkit_arena_create_growable_ex(0, 2 * MB, &aattr);
+    assert(grown != NULL);
+    p = nkit_arena_alloc(grown, 4096);
+    memset(p, 1, 4096);
+    assert(nkit_memory_page_nodes(p, 1, &where) == 1);
+    assert(where == 0);
+
+    size_t total = 0, free_bytes = 0;
+    assert(nkit_topo_node_memory(0, &total, &free_bytes) == 0);
+    attr.low_free_pct = 100.0 * (double)free_bytes / (double)total + 1.0;
+    mon = nkit_pressure_create(&attr);
+    assert(mon != NULL);
+    nkit_pressure_poll(mon);
+
+    if (nkit_pressure_level(0) == NKIT_PRESSURE_LOW && nkit_pressure_level(1) == NKIT_PRESSURE_NONE) {
+        arena = nkit_arena_create_ex(0, 2 * MB, &aattr);
+        assert(arena != NULL);
+        p = nkit_arena_alloc(arena, 4096);
+        memset(p, 1, 4096);
+        assert(nkit_memory_page_nodes(p, 1, &where) == 1);
+        assert(where != 0);
+        nkit_arena_destroy(arena);
+
+        assert(nkit_arena_alloc(grown, 2 * MB) != NULL);
+        p = nkit_arena_alloc(grown, 4096);
+        memset(p, 1, 4096);
+        assert(nkit_memory_page_nodes(p, 1, &where) == 1);
+        assert(where != 0);
+    }
+    nkit_arena_destroy(grown);
+    nkit_pressure_destroy(mon);
+
+    printf("  [Check] Spill To Nearest Node: OK\n");
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_22_mem_pressure(void) {
+    printf("[UNIT] Memory Pressure Test Started...\n");
+
+    if (nkit_init() != 0) {
+        printf("Failed to initialize libnumakit\n");
+        return 1;
+    }
+
+    test_pressure_levels();
+    test_pressure_reclaim();
+    test_pressure_spill();
+
+    printf("[UNIT] Memory Pressure Test Passed\n");
+    return 0;
+}
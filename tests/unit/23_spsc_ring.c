@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+// ============================================================================
+// Test 1: Push / Pop / Burst
+// ============================================================================
+static void test_spsc_basic(void) {
+    assert(nkit_spsc_create(0, 0) == NULL);
+    assert(nkit_spsc_create(0, 6) == NULL);   // Not a power of 2
+
+    nkit_spsc_t* ring = nkit_spsc_create(0, 8);
+    assert(ring != NULL);
+
+    // Indices live on separate cache lines
+    assert((uintptr_t)&ring->head % NKIT_CACHE_LINE == 0);
+    assert((uintptr_t)&ring->tail % NKIT_CACHE_LINE == 0);
+
+    void* out = NULL;
+    assert(!nkit_spsc_pop(ring, &out));
+
+    for (uintptr_t i = 1; i <= 8; i++) {
+        assert(nkit_spsc_push(ring, (void*)i));
+    }
+    assert(!nkit_spsc_push(ring, (void*)9));
+
+    for (uintptr_t i = 1; i <= 8; i++) {
+        assert(nkit_spsc_pop(ring, &out));
+        assert(out == (void*)i);
+    }
+    assert(!nkit_spsc_pop(ring, &out));
+
+    // Bursts wrap and stop at capacity
+    void* in[12];
+    void* got[12];
+    for (uintptr_t i = 0; i < 12; i++) in[i] = (void*)(i + 100);
+
+    assert(nkit_spsc_push(ring, (void*)1));
+    assert(nkit_spsc_push_burst(ring, in, 12) == 7);
+    assert(nkit_spsc_push_burst(ring, in, 1) == 0);
+    assert(nkit_spsc_pop(ring, &out) && out == (void*)1);
+    assert(nkit_spsc_pop_burst(ring, got, 12) == 7);
+    for (int i = 0; i < 7; i++) assert(got[i] == in[i]);
+    assert(nkit_spsc_pop_burst(ring, got, 12) == 0);
+
+    nkit_spsc_free(ring);
+    printf("  [Check] Push / Pop / Burst: OK\n");
+}
+
+// ============================================================================
+// Test 2: Producer / Consumer Threads
+// ============================================================================
+#define SPSC_ITEMS 1000000
+
+static void* spsc_producer(void* arg) {
+    nkit_spsc_t* ring = arg;
+    for (uintptr_t i = 1; i <= SPSC_ITEMS; i++) {
+        while (!nkit_spsc_push(ring, (void*)i)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void test_spsc_threads(void) {
+    nkit_spsc_t* ring = nkit_spsc_create(0, 1024);
+    assert(ring != NULL);
+
+    pthread_t prod;
+    pthread_create(&prod, NULL, spsc_producer, ring);
+
+    // Items arrive exactly once and in order
+    uintptr_t expect = 1;
+    void* batch[64];
+    while (expect <= SPSC_ITEMS) {
+        size_t got = nkit_spsc_pop_burst(ring, batch, 64);
+        if (got == 0) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < got; i++) {
+            assert(batch[i] == (void*)expect);
+            expect++;
+        }
+    }
+    pthread_join(prod, NULL);
+
+    void* out;
+    assert(!nkit_spsc_pop(ring, &out));
+
+    nkit_spsc_free(ring);
+    printf("  [Check] Ordered Handoff (%d items): OK\n", SPSC_ITEMS);
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_23_spsc_ring(void) {
+    printf("[UNIT] SPSC Ring Test Started...\n");
+
+    if (nkit_init() != 0) {
+        printf("Failed to initialize libnumakit\n");
+        return 1;
+    }
+
+    test_spsc_basic();
+    test_spsc_threads();
+
+    printf("[UNIT] SPSC Ring Test Passed\n");
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+// ============================================================================
+// Test 1: Eventcount Protocol
+// ============================================================================
+static void test_ec_protocol(void) {
+    nkit_eventcount_t ec;
+    nkit_ec_init(&ec);
+
+    // Notify with no waiter is a no-op
+    nkit_ec_notify(&ec);
+    assert(atomic_load(&ec.seq) == 0);
+
+    // Timeout
+    uint32_t key = nkit_ec_prepare_wait(&ec);
+    assert(atomic_load(&ec.waiters) == 1);
+    double t0 = now_ms();
+    assert(nkit_ec_wait(&ec, key, 20) == -1);
+    assert(now_ms() - t0 >= 15.0);
+    assert(atomic_load(&ec.waiters) == 0);
+
+    // A notify between prepare and wait is not lost
+    key = nkit_ec_prepare_wait(&ec);
+    nkit_ec_notify(&ec);
+    assert(nkit_ec_wait(&ec, key, -1) == 0);
+
+    key = nkit_ec_prepare_wait(&ec);
+    nkit_ec_cancel_wait(&ec);
+    assert(atomic_load(&ec.waiters) == 0);
+
+    printf("  [Check] Prepare / Wait / Notify: OK\n");
+}
+
+// ============================================================================
+// Test 2: Blocking Ring Pop
+// ============================================================================
+#define WAIT_ITEMS 2000
+
+static void* ring_producer(void* arg) {
+    nkit_ring_t* ring = arg;
+    for (uintptr_t i = 1; i <= WAIT_ITEMS; i++) {
+        // Let the consumer fall asleep now and then
+        if (i % 500 == 0) usleep(2000);
+        while (!nkit_ring_push(ring, (void*)i)) sched_yield();
+        nkit_ring_notify(ring);
+    }
+    return NULL;
+}
+
+static void test_ring_pop_wait(void) {
+    nkit_ring_t* ring = nkit_ring_create(0, 64);
+    assert(ring != NULL);
+
+    // Empty ring: times out
+    void* out = NULL;
+    double t0 = now_ms();
+    assert(!nkit_ring_pop_wait(ring, &out, 10));
+    assert(now_ms() - t0 >= 8.0);
+    assert(!nkit_ring_pop_wait(ring, &out, 0));
+
+    pthread_t prod;
+    pthread_create(&prod, NULL, ring_producer, ring);
+    for (uintptr_t i = 1; i <= WAIT_ITEMS; i++) {
+        assert(nkit_ring_pop_wait(ring, &out, -1));
+        assert(out == (void*)i);
+    }
+    pthread_join(prod, NULL);
+    assert(atomic_load(&ring->readable.waiters) == 0);
+
+    nkit_ring_free(ring);
+    printf("  [Check] nkit_ring_pop_wait: OK\n");
+}
+
+// ============================================================================
+// Test 3: Blocking Mailbox
+// ============================================================================
+static int g_mail_value;
+
+static void mail_handler(void* arg) {
+    g_mail_value += *(int*)arg;
+}
+
+static void* mail_sender(void* arg) {
+    static int msg = 1;
+    usleep(5000);
+    assert(nkit_send(*(int*)arg, &msg) == 0);
+    return NULL;
+}
+
+static void test_mailbox_wait(void) {
+    int node = nkit_current_node();
+    if (node < 0) node = 0;
+
+    assert(nkit_process_local_wait(mail_handler, 0, 5) == 0);
+
+    static int msg = 7;
+    assert(nkit_send(node, &msg) == 0);
+    assert(nkit_send(node, &msg) == 0);
+    g_mail_value = 0;
+    assert(nkit_process_local_wait(mail_handler, 0, -1) == 2);
+    assert(g_mail_value == 14);
+
+    // Woken by a sender that shows up later
+    pthread_t t;
+    static int target;
+    target = node;
+    pthread_create(&t, NULL, mail_sender, &target);
+    assert(nkit_process_local_wait(NULL, 1, 5000) == 1);
+    pthread_join(t, NULL);
+
+    printf("  [Check] nkit_process_local_wait: OK\n");
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_25_eventcount(void) {
+    printf("[UNIT] Eventcount Test Started...\n");
+
+    if (nkit_init() != 0) {
+        printf("Failed to initialize libnumakit\n");
+        return 1;
+    }
+
+    test_ec_protocol();
+    test_ring_pop_wait();
+    test_mailbox_wait();
+
+    printf("[UNIT] Eventcount Test Passed\n");
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+// ============================================================================
+// Test 1: FIFO Across Segments
+// ============================================================================
+static void test_mpsc_fifo(void) {
+    nkit_mpsc_t *q = nkit_mpsc_create(0);
+    assert(q != NULL);
+
+    void *out = (void *)1;
+    assert(!nkit_mpsc_pop(q, &out));
+
+    // NULL is an ordinary item
+    assert(nkit_mpsc_push(q, NULL) == 0);
+    assert(nkit_mpsc_pop(q, &out) && out == NULL);
+
+    // Far more than the old 4096-slot mailbox, without a single failure
+    const uintptr_t n = 20000;
+    for (uintptr_t i = 1; i <= n; i++) {
+        assert(nkit_mpsc_push(q, (void *)i) == 0);
+    }
+    for (uintptr_t i = 1; i <= n; i++) {
+        assert(nkit_mpsc_pop(q, &out));
+        assert(out == (void *)i);
+    }
+    assert(!nkit_mpsc_pop(q, &out));
+
+    // Bursts stop at the end of the queue
+    void *batch[64];
+    for (uintptr_t i = 1; i <= 40; i++) assert(nkit_mpsc_push(q, (void *)i) == 0);
+    assert(nkit_mpsc_pop_burst(q, batch, 64) == 40);
+    assert(batch[0] == (void *)1 && batch[39] == (void *)40);
+    assert(nkit_mpsc_pop_burst(q, batch, 64) == 0);
+
+    nkit_mpsc_destroy(q);
+    printf("  [Check] Unbounded FIFO: OK\n");
+}
+
+// ============================================================================
+// Test 2: Drained Segments Are Recycled
+// ============================================================================
+static void test_mpsc_recycle(void) {
+    nkit_mpsc_t *q = nkit_mpsc_create(0);
+    assert(q != NULL);
+
+    nkit_mem_stats_t before, after;
+    void *out;
+
+    // First burst grows the queue...
+    for (uintptr_t i = 0; i < 50000; i++) assert(nkit_mpsc_push(q, (void *)i) == 0);
+    while (nkit_mpsc_pop(q, &out)) {}
+    assert(nkit_mem_stats_snapshot(&before) == 0);
+
+    // ...later bursts of the same size reuse its segments
+    for (int round = 0; round < 5; round++) {
+        for (uintptr_t i = 0; i < 50000; i++) assert(nkit_mpsc_push(q, (void *)i) == 0);
+        while (nkit_mpsc_pop(q, &out)) {}
+    }
+    assert(nkit_mem_stats_snapshot(&after) == 0);
+    assert(after.nodes[0].bytes_mapped == before.nodes[0].bytes_mapped);
+
+    nkit_mpsc_destroy(q);
+    printf("  [Check] Segment Recycling: OK\n");
+}
+
+// ============================================================================
+// Test 3: Growth Past The Extent Table
+// ============================================================================
+static void test_mpsc_chain(void) {
+    nkit_mpsc_t *q = nkit_mpsc_create(0);
+    assert(q != NULL);
+
+    // 64 extents of the first extent's 64 segments x 504 slots no longer
+    // bound the queue; go well past that
+    const uintptr_t n = (uintptr_t)NKIT_SLAB_MAX_EXTENTS * 64 * 504 + 100000;
+    for (uintptr_t i = 0; i < n; i++) {
+        assert(nkit_mpsc_push(q, (void *)i) == 0);
+    }
+
+    void *out;
+    for (uintptr_t i = 0; i < n; i++) {
+        assert(nkit_mpsc_pop(q, &out));
+        assert(out == (void *)i);
+    }
+    assert(!nkit_mpsc_pop(q, &out));
+
+    nkit_mpsc_destroy(q);
+    printf("  [Check] Growth Past The Extent Table (%lu items): OK\n", (unsigned long)n);
+}
+
+// ============================================================================
+// Test 4: Concurrent Producers, Parked Consumer
+// ============================================================================
+#define MPSC_PRODUCERS 3
+#define MPSC_PER_PROD  100000
+
+typedef struct {
+    nkit_mpsc_t *q;
+    uintptr_t id;
+} mpsc_arg_t;
+
+static void *mpsc_producer(void *p) {
+    mpsc_arg_t *a = p;
+    for (uintptr_t i = 1; i <= MPSC_PER_PROD; i++) {
+        // Producer id in the low bits, sequence above
+        assert(nkit_mpsc_push(a->q, (void *)((i << 4) | a->id)) == 0);
+        if (i % 1000 == 0) nkit_mpsc_notify(a->q);
+    }
+    nkit_mpsc_notify(a->q);
+    return NULL;
+}
+
+static void test_mpsc_concurrent(void) {
+    nkit_mpsc_t *q = nkit_mpsc_create(0);
+    assert(q != NULL);
+
+    pthread_t threads[MPSC_PRODUCERS];
+    mpsc_arg_t args[MPSC_PRODUCERS];
+    for (int i = 0; i < MPSC_PRODUCERS; i++) {
+        args[i] = (mpsc_arg_t){ .q = q, .id = (uintptr_t)i };
+        pthread_create(&threads[i], NULL, mpsc_producer, &args[i]);
+    }
+
+    // Every item exactly once, each producer's items in order
+    uintptr_t last[MPSC_PRODUCERS] = { 0 };
+    for (int n = 0; n < MPSC_PRODUCERS * MPSC_PER_PROD; n++) {
+        void *item;
+        assert(nkit_mpsc_pop_wait(q, &item, 5000));
+        uintptr_t id = (uintptr_t)item & 0xF;
+        uintptr_t seq = (uintptr_t)item >> 4;
+        assert(id < MPSC_PRODUCERS);
+        assert(seq == last[id] + 1);
+        last[id] = seq;
+    }
+
+    for (int i = 0; i < MPSC_PRODUCERS; i++) pthread_join(threads[i], NULL);
+
+    void *left;
+    assert(!nkit_mpsc_pop(q, &left));
+
+    nkit_mpsc_destroy(q);
+    printf("  [Check] Concurrent Producers (%d x %d items): OK\n", MPSC_PRODUCERS, MPSC_PER_PROD);
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_26_mpsc_queue(void) {
+    printf("[UNIT] MPSC Queue Test Started...\n");
+
+    if (nkit_init() != 0) {
+        printf("Failed to initialize libnumakit\n");
+        return 1;
+    }
+
+    test_mpsc_fifo();
+    test_mpsc_recycle();
+    test_mpsc_chain();
+    test_mpsc_concurrent();
+
+    printf("[UNIT] MPSC Queue Test Passed\n");
+    return 0;
+}
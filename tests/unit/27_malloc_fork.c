@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include <numakit/numakit.h>
+#include "unit.h"
+
+// Under the malloc shim (see tests/CMakeLists.txt) every call below goes
+// through the pool; without it this checks glibc's own behaviour.
+
+#define FORK_THREADS 3
+#define FORK_ROUNDS  50
+
+static atomic_int g_stop;
+
+// ============================================================================
+// Test 1: Fork While Other Threads Allocate
+// ============================================================================
+static void *fork_churn(void *arg) {
+    uintptr_t seed = (uintptr_t)arg;
+    void *held[32] = { 0 };
+
+    while (!atomic_load(&g_stop)) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        size_t slot = (seed >> 33) % 32;
+        free(held[slot]);
+
+        // Small classes, aligned classes and large spans, so every lock
+        // of the pool is taken now and then
+        switch ((seed >> 40) % 3) {
+        case 0:  held[slot] = malloc(16 + (seed >> 48) % 2000); break;
+        case 1:  held[slot] = aligned_alloc(128, 128); break;
+        default: held[slot] = malloc(40000 + (seed >> 48) % 100000); break;
+        }
+        assert(held[slot] != NULL);
+    }
+
+    for (int i = 0; i < 32; i++) free(held[i]);
+    return NULL;
+}
+
+static void test_fork_under_allocation(void) {
+    pthread_t threads[FORK_THREADS];
+    atomic_store(&g_stop, 0);
+    for (uintptr_t i = 0; i < FORK_THREADS; i++) {
+        pthread_create(&threads[i], NULL, fork_churn, (void *)(i + 1));
+    }
+
+    for (int round = 0; round < FORK_ROUNDS; round++) {
+        pid_t pid = fork();
+        assert(pid >= 0);
+
+        if (pid == 0) {
+            // A lock inherited in the locked state would hang us here
+            alarm(10);
+            for (int i = 0; i < 100; i++) {
+                void *small = malloc(64);
+                void *large = malloc(200000);
+                void *aligned = aligned_alloc(256, 256);
+                if (!small || !large || !aligned) _exit(1);
+                memset(large, 0x5a, 200000);
+                free(small);
+                free(large);
+                free(aligned);
+            }
+            _exit(0);
+        }
+
+        int status = 0;
+        assert(waitpid(pid, &status, 0) == pid);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        usleep(1000);
+    }
+
+    atomic_store(&g_stop, 1);
+    for (int i = 0; i < FORK_THREADS; i++) pthread_join(threads[i], NULL);
+    printf("  [Check] Fork Under Allocation (%d forks, %d threads): OK\n",
+           FORK_ROUNDS, FORK_THREADS);
+}
+
+// ============================================================================
+// Entry Point
+// ============================================================================
+int test_27_malloc_fork(void) {
+    printf("[UNIT] Malloc Fork Test Started...\n");
+
+    if (nkit_init() != 0) {
+        printf("Failed to initialize libnumakit\n");
+        return 1;
+    }
+
+    test_fork_under_allocation();
+
+    printf("[UNIT] Malloc Fork Test Passed\n");
+    return 0;
+}
@@ -25,6 +25,15 @@ int main(int argc, char *argv[]) {
         printf("  16_ring_buffer    - Test Ring Buffer (16)\n");
         printf("  17_messaging      - Test Messaging System (17)\n");
         printf("  18_balancer       - Test Basic Balancer logic (18)\n");
+        printf("  19_arena          - Test arena chunks & bump allocation (19)\n");
+        printf("  20_replica        - Test replicated regions (20)\n");
+        printf("  21_mem_stats      - Test memory telemetry (21)\n");
+        printf("  22_mem_pressure   - Memory pressure monitor (22)\n");
+        printf("  23_spsc_ring      - Test SPSC ring (23)\n");
+        printf("  24_typed_ring     - Test inline-payload typed ring (24)\n");
+        printf("  25_eventcount     - Test futex eventcount and blocking rings (25)\n");
+        printf("  26_mpsc_queue     - Test unbounded segmented MPSC queue (26)\n");
+        printf("  27_malloc_fork    - Test fork while allocating (27)\n");
         printf("  all               - Run all units sequentially\n");
         return 1;
     }
@@ -67,6 +76,24 @@ int main(int argc, char *argv[]) {
         return test_17_messaging();
     } else if (strcmp(argv[1], "18_balancer") == 0) {
         return test_18_balancer();
+    } else if (strcmp(argv[1], "19_arena") == 0) {
+        return test_19_arena();
+    } else if (strcmp(argv[1], "20_replica") == 0) {
+        return test_20_replica();
+    } else if (strcmp(argv[1], "21_mem_stats") == 0) {
+        return test_21_mem_stats();
+    } else if (strcmp(argv[1], "22_mem_pressure") == 0) {
+        return test_22_mem_pressure();
+    } else if (strcmp(argv[1], "23_spsc_ring") == 0) {
+        return test_23_spsc_ring();
+    } else if (strcmp(argv[1], "24_typed_ring") == 0) {
+        return test_24_typed_ring();
+    } else if (strcmp(argv[1], "25_eventcount") == 0) {
+        return test_25_eventcount();
+    } else if (strcmp(argv[1], "26_mpsc_queue") == 0) {
+        return test_26_mpsc_queue();
+    } else if (strcmp(argv[1], "27_malloc_fork") == 0) {
+        return test_27_malloc_fork();
     } else if (strcmp(argv[1], "all") == 0) {
         printf(">>> RUNNING UNIT 00: SANITY CHECK <<<\n");
         test_00_sanity_check();
@@ -124,6 +151,33 @@ int main(int argc, char *argv[]) {
 
         printf("\n\n>>> RUNNING UNIT 18: BALANCER LOGIC <<<\n");
         test_18_balancer();
+
+        printf("\n\n>>> RUNNING UNIT 19: ARENA <<<\n");
+        test_19_arena();
+
+        printf("\n\n>>> RUNNING UNIT 20: REPLICATED REGIONS <<<\n");
+        test_20_replica();
+
+        printf("\n\n>>> RUNNING UNIT 21: MEMORY TELEMETRY <<<\n");
+        test_21_mem_stats();
+
+        printf("\n\n>>> RUNNING UNIT 22: MEMORY PRESSURE <<<\n");
+        test_22_mem_pressure();
+
+        printf("\n\n>>> RUNNING UNIT 23: SPSC RING <<<\n");
+        test_23_spsc_ring();
+
+        printf("\n\n>>> RUNNING UNIT 24: TYPED RING <<<\n");
+        test_24_typed_ring();
+
+        printf("\n\n>>> RUNNING UNIT 25: EVENTCOUNT <<<\n");
+        test_25_eventcount();
+
+        printf("\n\n>>> RUNNING UNIT 26: MPSC QUEUE <<<\n");
+        test_26_mpsc_queue();
+
+        printf("\n\n>>> RUNNING UNIT 27: MALLOC FORK <<<\n");
+        test_27_malloc_fork();
         return 0;
     }
 
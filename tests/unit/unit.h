@@ -20,5 +20,14 @@ int test_15_rws_lock(void);
 int test_16_ring_buffer(void);
 int test_17_messaging(void);
 int test_18_balancer(void);
+int test_19_arena(void);
+int test_20_replica(void);
+int test_21_mem_stats(void);
+int test_22_mem_pressure(void);
+int test_23_spsc_ring(void);
+int test_24_typed_ring(void);
+int test_25_eventcount(void);
+int test_26_mpsc_queue(void);
+int test_27_malloc_fork(void);
 
 #endif